@@ -16,9 +16,14 @@
 #ifndef PSEN_SCAN_V2_LASERSCAN_ROS_CONVERSIONS_H
 #define PSEN_SCAN_V2_LASERSCAN_ROS_CONVERSIONS_H
 
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 #include <sensor_msgs/LaserScan.h>
 
 #include "psen_scan_v2_standalone/configuration/default_parameters.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_sample_conversion.h"
 #include "psen_scan_v2_standalone/laserscan.h"
 
 namespace psen_scan_v2
@@ -46,11 +51,55 @@ sensor_msgs::LaserScan toLaserScanMsg(const LaserScan& laserscan,
   ros_message.range_min = configuration::RANGE_MIN_IN_M;
   ros_message.range_max = configuration::RANGE_MAX_IN_M;
 
-  ros_message.ranges.insert(
-      ros_message.ranges.begin(), laserscan.measurements().cbegin(), laserscan.measurements().cend());
+  if (laserscan.hasRawSamples())
+  {
+    using data_conversion_layer::monitoring_frame::convertRawIntensities;
+    using data_conversion_layer::monitoring_frame::convertRawMeasurements;
+    using data_conversion_layer::monitoring_frame::numberOfIntensityFlagBytes;
+
+    const auto& raw_measurements{ laserscan.rawMeasurements() };
+    ros_message.ranges.resize(raw_measurements.size());
+    convertRawMeasurements(
+        reinterpret_cast<const char*>(raw_measurements.data()), raw_measurements.size(), ros_message.ranges.data());
+
+    const auto& raw_intensities{ laserscan.rawIntensities() };
+    std::vector<uint8_t> intensity_flags(numberOfIntensityFlagBytes(raw_intensities.size()));
+    ros_message.intensities.resize(raw_intensities.size());
+    convertRawIntensities(reinterpret_cast<const char*>(raw_intensities.data()),
+                          raw_intensities.size(),
+                          ros_message.intensities.data(),
+                          intensity_flags.data());
+
+    // Gaps of a partial scan would otherwise look like real "no signal" readings.
+    if (laserscan.isPartial())
+    {
+      const float nan{ std::numeric_limits<float>::quiet_NaN() };
+      for (std::size_t i = 0; i < raw_measurements.size(); ++i)
+      {
+        if (raw_measurements[i] == LaserScan::MISSING_RAW_MEASUREMENT)
+        {
+          ros_message.ranges[i] = nan;
+          if (i < ros_message.intensities.size())
+          {
+            ros_message.intensities[i] = nan;
+          }
+        }
+      }
+    }
+  }
+  else if (laserscan.isSinglePrecision())
+  {
+    ros_message.ranges = laserscan.singlePrecisionMeasurements();
+    ros_message.intensities = laserscan.singlePrecisionIntensities();
+  }
+  else
+  {
+    ros_message.ranges.insert(
+        ros_message.ranges.begin(), laserscan.measurements().cbegin(), laserscan.measurements().cend());
 
-  ros_message.intensities.insert(
-      ros_message.intensities.begin(), laserscan.intensities().cbegin(), laserscan.intensities().cend());
+    ros_message.intensities.insert(
+        ros_message.intensities.begin(), laserscan.intensities().cbegin(), laserscan.intensities().cend());
+  }
 
   return ros_message;
 }
@@ -97,6 +97,8 @@ int main(int argc, char** argv)
               getOptionalParamFromServer<bool>(pnh, PARAM_FRAGMENTED_SCANS, configuration::FRAGMENTED_SCANS))
           .nrSubscribers(getOptionalParamFromServer<int>(pnh, PARAM_NR_SUBSCRIBERS, configuration::NR_SUBSCRIBERS))
           .enableIntensities(getOptionalParamFromServer<bool>(pnh, PARAM_INTENSITIES, configuration::INTENSITIES))
+          // sensor_msgs::LaserScan stores float, so there is no need to process the data in double precision.
+          .enableSinglePrecision()
           .scanResolution(util::TenthOfDegree::fromRad(
               getOptionalParamFromServer<double>(pnh, PARAM_RESOLUTION, configuration::DEFAULT_SCAN_ANGLE_RESOLUTION)))
           .build()
@@ -0,0 +1,109 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_IO_SERVICE_THREAD_POOL_H
+#define PSEN_SCAN_V2_STANDALONE_IO_SERVICE_THREAD_POOL_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "psen_scan_v2_standalone/util/thread_scheduling.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace communication_layer
+{
+/**
+ * @brief Runs an io_service in a fixed number of threads.
+ *
+ * The io_service can be passed to several UdpClientImpl (or ScannerV2) instances, so that they share the threads
+ * instead of creating one thread per socket. The operations of each socket stay serialized on a strand of the client.
+ *
+ * @note The pool has to outlive all clients using its io_service.
+ */
+class IoServiceThreadPool
+{
+public:
+  /**
+   * @brief Starts number_of_threads threads running the io_service.
+   *
+   * @param scheduling CPU affinity and real-time scheduling of the threads, settings which cannot be applied are
+   * skipped with a warning.
+   * @throws std::invalid_argument if number_of_threads is 0.
+   */
+  explicit IoServiceThreadPool(const std::size_t& number_of_threads = 1,
+                               const util::ThreadScheduling& scheduling = util::ThreadScheduling());
+  //! @brief Stops the io_service and waits for all threads to finish.
+  ~IoServiceThreadPool();
+
+  IoServiceThreadPool(const IoServiceThreadPool&) = delete;
+  IoServiceThreadPool& operator=(const IoServiceThreadPool&) = delete;
+
+public:
+  boost::asio::io_service& ioService();
+  std::size_t numberOfThreads() const;
+
+private:
+  boost::asio::io_service io_service_;
+  // Prevent the run() method of the io_service from returning when there is no more work.
+  boost::asio::io_service::work work_{ io_service_ };
+  std::vector<std::thread> threads_;
+};
+
+inline IoServiceThreadPool::IoServiceThreadPool(const std::size_t& number_of_threads,
+                                                const util::ThreadScheduling& scheduling)
+{
+  if (number_of_threads == 0)
+  {
+    throw std::invalid_argument("Number of threads of the io_service has to be greater than 0");
+  }
+  threads_.reserve(number_of_threads);
+  for (std::size_t i = 0; i < number_of_threads; ++i)
+  {
+    threads_.emplace_back([this]() { io_service_.run(); });
+    if (scheduling != util::ThreadScheduling())
+    {
+      util::applyThreadScheduling(threads_.back(), scheduling, "IoServiceThreadPool " + std::to_string(i));
+    }
+  }
+}
+
+inline IoServiceThreadPool::~IoServiceThreadPool()
+{
+  io_service_.stop();
+  for (auto& thread : threads_)
+  {
+    thread.join();
+  }
+}
+
+inline boost::asio::io_service& IoServiceThreadPool::ioService()
+{
+  return io_service_;
+}
+
+inline std::size_t IoServiceThreadPool::numberOfThreads() const
+{
+  return threads_.size();
+}
+
+}  // namespace communication_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_IO_SERVICE_THREAD_POOL_H
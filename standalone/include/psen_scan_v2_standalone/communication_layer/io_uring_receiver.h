@@ -0,0 +1,496 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_IO_URING_RECEIVER_H
+#define PSEN_SCAN_V2_STANDALONE_IO_URING_RECEIVER_H
+
+#ifdef __linux__
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+#endif
+
+// Multishot receive and provided buffer rings are declared by the kernel headers of Linux 6.0 and newer.
+#if defined(__linux__) && defined(IORING_RECV_MULTISHOT)
+#define PSEN_SCAN_V2_STANDALONE_IO_URING_SUPPORTED
+#endif
+
+#ifdef PSEN_SCAN_V2_STANDALONE_IO_URING_SUPPORTED
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "psen_scan_v2_standalone/communication_layer/receive_buffer_pool.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace communication_layer
+{
+/**
+ * @brief Receives the datagrams of a socket via a multishot receive of io_uring.
+ *
+ * A single submission keeps receiving until it is canceled. The kernel picks a buffer for each datagram from a ring of
+ * buffers registered with it and posts a completion to memory shared with the process. Reading the received datagrams
+ * therefore needs no syscall, the owner only has to wait until fd() becomes readable and call processCompletions().
+ *
+ * Each datagram is passed on in its own buffer, which is replaced in the buffer ring by a buffer of a
+ * ReceiveBufferPool. Like in UdpClientImpl a buffer is not reused before all copies of its pointer are released.
+ *
+ * The ring is not synchronized, all methods have to be called by the same thread or on the same strand.
+ *
+ * @note Requires Linux 6.0 or newer. The thread submitting the receive should be the one waiting for fd(), because the
+ * kernel completes the receive in the context of the submitting thread.
+ */
+class IoUringReceiver
+{
+public:
+  /**
+   * @brief Exception thrown if io_uring or one of the required features is not available.
+   */
+  class SetupFailure : public std::runtime_error
+  {
+  public:
+    SetupFailure(const std::string& msg);
+  };
+
+public:
+  /**
+   * @brief Creates the ring and registers number_of_buffers buffers with the kernel.
+   *
+   * @param socket_fd Socket to receive from, has to outlive the receiver.
+   * @param max_datagram_size Larger datagrams are truncated to max_datagram_size + 1 bytes, so they can be detected by
+   * the caller.
+   * @param control_buffer_size Space for the control messages (e.g. timestamps) of each datagram.
+   * @param number_of_buffers Has to be a power of 2.
+   *
+   * @throws SetupFailure if io_uring is not available, e.g. because it is disabled by the kernel or a seccomp filter.
+   * @throws std::invalid_argument if number_of_buffers is not a power of 2 or exceeds MAX_NUMBER_OF_BUFFERS.
+   */
+  IoUringReceiver(const int socket_fd,
+                  const std::size_t max_datagram_size,
+                  const std::size_t control_buffer_size,
+                  const std::size_t number_of_buffers = DEFAULT_NUMBER_OF_BUFFERS);
+  //! @brief Cancels the receive and waits until the kernel released the buffers.
+  ~IoUringReceiver();
+
+  IoUringReceiver(const IoUringReceiver&) = delete;
+  IoUringReceiver& operator=(const IoUringReceiver&) = delete;
+
+public:
+  //! @brief File descriptor of the ring, it becomes readable once completions are waiting.
+  int fd() const;
+  //! @brief Submits the multishot receive.
+  void start();
+  //! @brief Cancels the receive, the cancellation completes with the next call of processCompletions().
+  void cancel();
+  //! @brief Returns true while the receive is submitted and not finished.
+  bool receiving() const;
+  //! @brief Returns true if completions are waiting to be processed.
+  bool completionsPending() const;
+
+  /**
+   * @brief Passes on all waiting completions.
+   *
+   * The receive is resubmitted if the kernel terminated it, unless it was canceled or failed with EINVAL. The latter
+   * indicates that the kernel does not support multishot receive for the socket, receiving() is false afterwards.
+   *
+   * @param on_datagram Called as on_datagram(const RawDataPtr& data, std::size_t bytes_received, msghdr& control) for
+   * each received datagram. data contains the payload at its beginning, control the attached control messages.
+   * @param on_error Called as on_error(int error_number) for every failed receive.
+   *
+   * @returns The number of datagrams passed on.
+   */
+  template <typename DatagramHandler, typename ErrorHandler>
+  std::size_t processCompletions(const DatagramHandler& on_datagram, const ErrorHandler& on_error);
+
+public:
+  static constexpr std::size_t DEFAULT_NUMBER_OF_BUFFERS{ 64 };
+  //! Limit of the kernel for the entries of a provided buffer ring.
+  static constexpr std::size_t MAX_NUMBER_OF_BUFFERS{ 32768 };
+
+private:
+  //! Identifies the submissions in their completions.
+  enum UserData : uint64_t
+  {
+    receive_request = 1,
+    cancel_request = 2
+  };
+  //! Only the receive and its cancellation are submitted, a few entries suffice.
+  static constexpr unsigned int NUMBER_OF_RING_ENTRIES{ 4 };
+  static constexpr uint16_t BUFFER_GROUP_ID{ 0 };
+
+  void mapRings();
+  void registerBufferRing();
+  //! @brief Hands the buffer with the given id to the kernel, the previous one was passed on.
+  void provideBuffer(const uint16_t& buffer_id);
+  void submit(const uint8_t& opcode, const uint64_t& user_data);
+  template <typename CompletionHandler>
+  void forEachCompletion(const CompletionHandler& handler);
+  std::size_t payloadOffset() const;
+  void release();
+
+private:
+  const int socket_fd_;
+  int ring_fd_{ -1 };
+  io_uring_params params_{};
+
+  void* ring_memory_{ MAP_FAILED };
+  std::size_t ring_memory_size_{ 0 };
+  io_uring_sqe* sqes_{ static_cast<io_uring_sqe*>(MAP_FAILED) };
+  std::size_t sqes_size_{ 0 };
+  unsigned int* sq_tail_{ nullptr };
+  unsigned int* sq_array_{ nullptr };
+  unsigned int sq_mask_{ 0 };
+  unsigned int* cq_head_{ nullptr };
+  unsigned int* cq_tail_{ nullptr };
+  io_uring_cqe* cqes_{ nullptr };
+  unsigned int cq_mask_{ 0 };
+
+  io_uring_buf_ring* buffer_ring_{ static_cast<io_uring_buf_ring*>(MAP_FAILED) };
+  std::size_t buffer_ring_size_{ 0 };
+  uint16_t buffer_ring_tail_{ 0 };
+  const std::size_t number_of_buffers_;
+  //! Space for the header written by the kernel, the control messages and one spare byte to detect too large
+  //! datagrams.
+  const std::size_t buffer_size_;
+  std::shared_ptr<ReceiveBufferPool> buffer_pool_;
+  //! Buffers currently owned by the kernel, indexed by their buffer id.
+  std::vector<data_conversion_layer::RawDataPtr> buffers_;
+
+  //! Only the lengths of name and control messages are used by a multishot receive.
+  msghdr msg_{};
+  //! The control messages are copied here, because the payload is moved over them.
+  std::vector<char> control_messages_;
+  bool receiving_{ false };
+  bool canceled_{ false };
+};
+
+inline IoUringReceiver::IoUringReceiver(const int socket_fd,
+                                        const std::size_t max_datagram_size,
+                                        const std::size_t control_buffer_size,
+                                        const std::size_t number_of_buffers)
+  : socket_fd_(socket_fd)
+  , number_of_buffers_(number_of_buffers)
+  , buffer_size_(sizeof(io_uring_recvmsg_out) + control_buffer_size + max_datagram_size + 1)
+  , control_messages_(control_buffer_size)
+{
+  if (number_of_buffers == 0 || number_of_buffers > MAX_NUMBER_OF_BUFFERS ||
+      (number_of_buffers & (number_of_buffers - 1)) != 0)
+  {
+    throw std::invalid_argument("Number of io_uring buffers has to be a power of 2 not larger than " +
+                                std::to_string(MAX_NUMBER_OF_BUFFERS));
+  }
+  msg_.msg_namelen = 0;
+  msg_.msg_controllen = control_buffer_size;
+  // Every datagram completion uses up a buffer, which is only provided again once the completion was processed. So the
+  // completion queue cannot overflow if it has more entries than there are buffers.
+  params_.flags = IORING_SETUP_CQSIZE;
+  params_.cq_entries = static_cast<uint32_t>(2 * number_of_buffers);
+
+  ring_fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, NUMBER_OF_RING_ENTRIES, &params_));
+  if (ring_fd_ < 0)
+  {
+    throw SetupFailure(std::string("io_uring_setup failed: ") + std::strerror(errno));
+  }
+  try
+  {
+    mapRings();
+    registerBufferRing();
+  }
+  catch (const SetupFailure&)
+  {
+    release();
+    throw;
+  }
+}
+
+inline IoUringReceiver::~IoUringReceiver()
+{
+  if (receiving_)
+  {
+    if (!canceled_)
+    {
+      cancel();
+    }
+    // The buffers must not be freed before the kernel finished the receive.
+    while (receiving_)
+    {
+      if (!completionsPending() &&
+          ::syscall(__NR_io_uring_enter, ring_fd_, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 && errno != EINTR)
+      {
+        break;  // LCOV_EXCL_LINE Waiting only fails if the ring is broken.
+      }
+      forEachCompletion([this](const io_uring_cqe& cqe) {
+        if (cqe.user_data == receive_request && (cqe.flags & IORING_CQE_F_MORE) == 0)
+        {
+          receiving_ = false;
+        }
+      });
+    }
+  }
+  release();
+}
+
+inline int IoUringReceiver::fd() const
+{
+  return ring_fd_;
+}
+
+inline void IoUringReceiver::start()
+{
+  canceled_ = false;
+  receiving_ = true;
+  submit(IORING_OP_RECVMSG, receive_request);
+}
+
+inline void IoUringReceiver::cancel()
+{
+  if (receiving_ && !canceled_)
+  {
+    canceled_ = true;
+    submit(IORING_OP_ASYNC_CANCEL, cancel_request);
+  }
+}
+
+inline bool IoUringReceiver::receiving() const
+{
+  return receiving_;
+}
+
+inline bool IoUringReceiver::completionsPending() const
+{
+  return *cq_head_ != __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+}
+
+template <typename DatagramHandler, typename ErrorHandler>
+inline std::size_t IoUringReceiver::processCompletions(const DatagramHandler& on_datagram,
+                                                       const ErrorHandler& on_error)
+{
+  std::size_t datagrams{ 0 };
+  bool resubmit{ false };
+  forEachCompletion([&](const io_uring_cqe& cqe) {
+    if (cqe.user_data != receive_request)
+    {
+      return;  // Completion of the cancellation.
+    }
+    if ((cqe.flags & IORING_CQE_F_MORE) == 0)
+    {
+      receiving_ = false;
+      // ENOBUFS only means that all buffers were in use, new ones are provided below.
+      resubmit = !canceled_ && cqe.res != -EINVAL && cqe.res != -ECANCELED;
+    }
+    if (cqe.res < 0)
+    {
+      if (cqe.res != -ENOBUFS && cqe.res != -ECANCELED)
+      {
+        on_error(-cqe.res);
+      }
+      return;
+    }
+
+    const uint16_t buffer_id{ static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT) };
+    const data_conversion_layer::RawDataPtr data{ std::move(buffers_[buffer_id]) };
+    provideBuffer(buffer_id);
+    if (canceled_)
+    {
+      return;
+    }
+
+    io_uring_recvmsg_out header;
+    std::memcpy(&header, data->data(), sizeof(header));
+    const std::size_t control_length{ std::min<std::size_t>(header.controllen, control_messages_.size()) };
+    std::memcpy(control_messages_.data(), data->data() + sizeof(header) + msg_.msg_namelen, control_length);
+    // The payload is moved to the beginning of the buffer, where the consumer expects it.
+    const std::size_t bytes_received{ std::min<std::size_t>(header.payloadlen, cqe.res - payloadOffset()) };
+    std::memmove(data->data(), data->data() + payloadOffset(), bytes_received);
+
+    msghdr control{};
+    control.msg_control = control_messages_.data();
+    control.msg_controllen = control_length;
+    ++datagrams;
+    on_datagram(data, bytes_received, control);
+  });
+  if (resubmit)
+  {
+    start();
+  }
+  return datagrams;
+}
+
+template <typename CompletionHandler>
+inline void IoUringReceiver::forEachCompletion(const CompletionHandler& handler)
+{
+  unsigned int head{ *cq_head_ };
+  const unsigned int tail{ __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE) };
+  while (head != tail)
+  {
+    const io_uring_cqe cqe{ cqes_[head & cq_mask_] };
+    ++head;
+    // Released right away, so the kernel can reuse the entry while the datagram is processed.
+    __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+    handler(cqe);
+  }
+}
+
+inline void IoUringReceiver::mapRings()
+{
+  if ((params_.features & IORING_FEAT_SINGLE_MMAP) == 0)
+  {
+    throw SetupFailure("io_uring without IORING_FEAT_SINGLE_MMAP is not supported");
+  }
+  ring_memory_size_ = std::max(params_.sq_off.array + params_.sq_entries * sizeof(unsigned int),
+                               params_.cq_off.cqes + params_.cq_entries * sizeof(io_uring_cqe));
+  ring_memory_ = ::mmap(
+      nullptr, ring_memory_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+  sqes_size_ = params_.sq_entries * sizeof(io_uring_sqe);
+  sqes_ = static_cast<io_uring_sqe*>(
+      ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES));
+  if (ring_memory_ == MAP_FAILED || sqes_ == MAP_FAILED)
+  {
+    throw SetupFailure(std::string("Mapping the io_uring failed: ") + std::strerror(errno));  // LCOV_EXCL_LINE
+  }
+
+  char* const ring{ static_cast<char*>(ring_memory_) };
+  sq_tail_ = reinterpret_cast<unsigned int*>(ring + params_.sq_off.tail);
+  sq_array_ = reinterpret_cast<unsigned int*>(ring + params_.sq_off.array);
+  sq_mask_ = *reinterpret_cast<unsigned int*>(ring + params_.sq_off.ring_mask);
+  cq_head_ = reinterpret_cast<unsigned int*>(ring + params_.cq_off.head);
+  cq_tail_ = reinterpret_cast<unsigned int*>(ring + params_.cq_off.tail);
+  cqes_ = reinterpret_cast<io_uring_cqe*>(ring + params_.cq_off.cqes);
+  cq_mask_ = *reinterpret_cast<unsigned int*>(ring + params_.cq_off.ring_mask);
+}
+
+inline void IoUringReceiver::registerBufferRing()
+{
+  buffer_ring_size_ = number_of_buffers_ * sizeof(io_uring_buf);
+  buffer_ring_ = static_cast<io_uring_buf_ring*>(
+      ::mmap(nullptr, buffer_ring_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0));
+  if (buffer_ring_ == MAP_FAILED)
+  {
+    throw SetupFailure(std::string("Allocating the io_uring buffer ring failed: ") +  // LCOV_EXCL_LINE
+                       std::strerror(errno));                                         // LCOV_EXCL_LINE
+  }
+
+  io_uring_buf_reg registration{};
+  registration.ring_addr = reinterpret_cast<uint64_t>(buffer_ring_);
+  registration.ring_entries = static_cast<uint32_t>(number_of_buffers_);
+  registration.bgid = BUFFER_GROUP_ID;
+  if (::syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_PBUF_RING, &registration, 1) != 0)
+  {
+    throw SetupFailure(std::string("Registering the io_uring buffer ring failed: ") + std::strerror(errno));
+  }
+
+  // A whole set of buffers might be held by the consumer while the next one is received.
+  buffer_pool_ = ReceiveBufferPool::create(2 * number_of_buffers_, buffer_size_);
+  buffers_.resize(number_of_buffers_);
+  for (std::size_t i = 0; i < number_of_buffers_; ++i)
+  {
+    provideBuffer(static_cast<uint16_t>(i));
+  }
+}
+
+inline void IoUringReceiver::provideBuffer(const uint16_t& buffer_id)
+{
+  buffers_[buffer_id] = buffer_pool_->acquire();
+  // The entries are not accessed via io_uring_buf_ring::bufs, because its flexible array member is placed behind an
+  // empty struct in C++, which shifts it by 8 bytes. The tail overlaps the first entry.
+  io_uring_buf& entry{ reinterpret_cast<io_uring_buf*>(buffer_ring_)[buffer_ring_tail_ & (number_of_buffers_ - 1)] };
+  entry.addr = reinterpret_cast<uint64_t>(buffers_[buffer_id]->data());
+  entry.len = static_cast<uint32_t>(buffer_size_);
+  entry.bid = buffer_id;
+  ++buffer_ring_tail_;
+  __atomic_store_n(&buffer_ring_->tail, buffer_ring_tail_, __ATOMIC_RELEASE);
+}
+
+inline void IoUringReceiver::submit(const uint8_t& opcode, const uint64_t& user_data)
+{
+  const unsigned int tail{ *sq_tail_ };
+  const unsigned int index{ tail & sq_mask_ };
+  io_uring_sqe& sqe{ sqes_[index] };
+  std::memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = opcode;
+  sqe.user_data = user_data;
+  if (opcode == IORING_OP_RECVMSG)
+  {
+    sqe.fd = socket_fd_;
+    sqe.addr = reinterpret_cast<uint64_t>(&msg_);
+    sqe.len = 1;
+    sqe.ioprio = IORING_RECV_MULTISHOT;
+    sqe.flags = IOSQE_BUFFER_SELECT;
+    sqe.buf_group = BUFFER_GROUP_ID;
+  }
+  else
+  {
+    sqe.fd = -1;
+    sqe.addr = receive_request;
+  }
+  sq_array_[index] = index;
+  __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+
+  while (::syscall(__NR_io_uring_enter, ring_fd_, 1, 0, 0, nullptr, 0) < 0 && errno == EINTR)
+  {
+  }
+}
+
+inline std::size_t IoUringReceiver::payloadOffset() const
+{
+  return sizeof(io_uring_recvmsg_out) + msg_.msg_namelen + msg_.msg_controllen;
+}
+
+inline void IoUringReceiver::release()
+{
+  if (ring_fd_ >= 0)
+  {
+    ::close(ring_fd_);
+    ring_fd_ = -1;
+  }
+  if (buffer_ring_ != MAP_FAILED)
+  {
+    ::munmap(buffer_ring_, buffer_ring_size_);
+  }
+  if (sqes_ != MAP_FAILED)
+  {
+    ::munmap(sqes_, sqes_size_);
+  }
+  if (ring_memory_ != MAP_FAILED)
+  {
+    ::munmap(ring_memory_, ring_memory_size_);
+  }
+}
+
+inline IoUringReceiver::SetupFailure::SetupFailure(const std::string& msg) : std::runtime_error(msg)
+{
+}
+
+}  // namespace communication_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_IO_URING_SUPPORTED
+#endif  // PSEN_SCAN_V2_STANDALONE_IO_URING_RECEIVER_H
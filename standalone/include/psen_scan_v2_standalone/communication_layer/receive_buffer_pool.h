@@ -0,0 +1,222 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_RECEIVE_BUFFER_POOL_H
+#define PSEN_SCAN_V2_STANDALONE_RECEIVE_BUFFER_POOL_H
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace communication_layer
+{
+/**
+ * @brief Fixed number of preallocated receive buffers which are recycled once they are no longer referenced.
+ *
+ * A buffer handed out by acquire() belongs to the receiver of the RawDataPtr. It stays valid and unchanged until the
+ * last copy of the pointer is released, so the data can be passed on to other threads without copying. Afterwards
+ * the buffer returns to the pool automatically.
+ *
+ * Neither acquire() nor the release of a buffer allocate memory: The control block of the shared_ptr is placed in
+ * storage reserved next to each buffer. If all buffers are in use, acquire() falls back to allocating a new buffer.
+ *
+ * The pool is kept alive by the buffers handed out, so it can be released by its owner at any time.
+ */
+class ReceiveBufferPool : public std::enable_shared_from_this<ReceiveBufferPool>
+{
+public:
+  //! @brief Creates a pool with number_of_buffers preallocated buffers of buffer_size bytes each.
+  static std::shared_ptr<ReceiveBufferPool>
+  create(const std::size_t number_of_buffers,
+         const std::size_t buffer_size = data_conversion_layer::MAX_UDP_PAKET_SIZE);
+
+public:
+  //! @brief Returns a free buffer of bufferSize() bytes, its content is left from its previous use.
+  data_conversion_layer::RawDataPtr acquire();
+
+  std::size_t numberOfBuffers() const;
+  std::size_t numberOfFreeBuffers() const;
+  std::size_t bufferSize() const;
+
+private:
+  //! Storage for the control block of the shared_ptr handed out for a buffer.
+  static constexpr std::size_t CONTROL_BLOCK_STORAGE_SIZE{ 128 };
+
+  struct Slot
+  {
+    Slot(const std::size_t& buffer_size) : data(buffer_size)
+    {
+    }
+
+    alignas(std::max_align_t) unsigned char control_block[CONTROL_BLOCK_STORAGE_SIZE];
+    data_conversion_layer::RawData data;
+  };
+
+  /**
+   * @brief Places the control block of a buffer in the storage of its slot.
+   *
+   * The slot is returned to the pool in deallocate(), which is called after the control block was destroyed. So a
+   * recycled slot can never be acquired while its previous control block is still in use.
+   */
+  template <typename T>
+  class SlotAllocator
+  {
+  public:
+    using value_type = T;
+
+    SlotAllocator(const std::shared_ptr<ReceiveBufferPool>& pool, Slot* slot);
+    template <typename U>
+    SlotAllocator(const SlotAllocator<U>& other);
+
+    T* allocate(std::size_t n);
+    void deallocate(T* /*p*/, std::size_t /*n*/);
+
+    template <typename U>
+    bool operator==(const SlotAllocator<U>& rhs) const;
+    template <typename U>
+    bool operator!=(const SlotAllocator<U>& rhs) const;
+
+  private:
+    template <typename U>
+    friend class SlotAllocator;
+
+    std::shared_ptr<ReceiveBufferPool> pool_;
+    Slot* slot_;
+  };
+
+private:
+  ReceiveBufferPool(const std::size_t& number_of_buffers, const std::size_t& buffer_size);
+  void release(Slot* slot);
+
+private:
+  const std::size_t buffer_size_;
+  std::vector<std::unique_ptr<Slot>> slots_;
+  std::vector<Slot*> free_slots_;
+  mutable std::mutex free_slots_mutex_;
+};
+
+inline std::shared_ptr<ReceiveBufferPool> ReceiveBufferPool::create(const std::size_t number_of_buffers,
+                                                                    const std::size_t buffer_size)
+{
+  return std::shared_ptr<ReceiveBufferPool>(new ReceiveBufferPool(number_of_buffers, buffer_size));
+}
+
+inline ReceiveBufferPool::ReceiveBufferPool(const std::size_t& number_of_buffers, const std::size_t& buffer_size)
+  : buffer_size_(buffer_size)
+{
+  slots_.reserve(number_of_buffers);
+  free_slots_.reserve(number_of_buffers);
+  for (std::size_t i = 0; i < number_of_buffers; ++i)
+  {
+    slots_.emplace_back(new Slot(buffer_size));
+    free_slots_.push_back(slots_.back().get());
+  }
+}
+
+inline data_conversion_layer::RawDataPtr ReceiveBufferPool::acquire()
+{
+  Slot* slot{ nullptr };
+  {
+    std::lock_guard<std::mutex> lock(free_slots_mutex_);
+    if (!free_slots_.empty())
+    {
+      slot = free_slots_.back();
+      free_slots_.pop_back();
+    }
+  }
+  if (slot == nullptr)
+  {
+    return std::make_shared<data_conversion_layer::RawData>(buffer_size_);
+  }
+  // The buffer itself is owned by the slot, so the deleter does nothing.
+  return data_conversion_layer::RawDataPtr(
+      &slot->data, [](data_conversion_layer::RawData* /*data*/) {}, SlotAllocator<char>(shared_from_this(), slot));
+}
+
+inline std::size_t ReceiveBufferPool::numberOfBuffers() const
+{
+  return slots_.size();
+}
+
+inline std::size_t ReceiveBufferPool::numberOfFreeBuffers() const
+{
+  std::lock_guard<std::mutex> lock(free_slots_mutex_);
+  return free_slots_.size();
+}
+
+inline std::size_t ReceiveBufferPool::bufferSize() const
+{
+  return buffer_size_;
+}
+
+inline void ReceiveBufferPool::release(Slot* slot)
+{
+  std::lock_guard<std::mutex> lock(free_slots_mutex_);
+  free_slots_.push_back(slot);
+}
+
+template <typename T>
+inline ReceiveBufferPool::SlotAllocator<T>::SlotAllocator(const std::shared_ptr<ReceiveBufferPool>& pool, Slot* slot)
+  : pool_(pool), slot_(slot)
+{
+}
+
+template <typename T>
+template <typename U>
+inline ReceiveBufferPool::SlotAllocator<T>::SlotAllocator(const SlotAllocator<U>& other)
+  : pool_(other.pool_), slot_(other.slot_)
+{
+}
+
+template <typename T>
+inline T* ReceiveBufferPool::SlotAllocator<T>::allocate(std::size_t n)
+{
+  static_assert(sizeof(T) <= CONTROL_BLOCK_STORAGE_SIZE, "Control block does not fit into the slot.");
+  static_assert(alignof(T) <= alignof(std::max_align_t), "Control block is over-aligned.");
+  assert(n == 1 && "Only one control block per slot can be allocated.");
+  return reinterpret_cast<T*>(slot_->control_block);
+}
+
+template <typename T>
+inline void ReceiveBufferPool::SlotAllocator<T>::deallocate(T* /*p*/, std::size_t /*n*/)
+{
+  // The allocator is a copy which outlives the control block, so the pool is still alive here.
+  pool_->release(slot_);
+}
+
+template <typename T>
+template <typename U>
+inline bool ReceiveBufferPool::SlotAllocator<T>::operator==(const SlotAllocator<U>& rhs) const
+{
+  return slot_ == rhs.slot_;
+}
+
+template <typename T>
+template <typename U>
+inline bool ReceiveBufferPool::SlotAllocator<T>::operator!=(const SlotAllocator<U>& rhs) const
+{
+  return !(*this == rhs);
+}
+
+}  // namespace communication_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_RECEIVE_BUFFER_POOL_H
@@ -0,0 +1,51 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_RECEIVE_STATISTICS_H
+#define PSEN_SCAN_V2_STANDALONE_RECEIVE_STATISTICS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace psen_scan_v2_standalone
+{
+namespace communication_layer
+{
+/**
+ * @brief Counters of the datagrams received by an UdpClientImpl.
+ *
+ * Datagrams dropped by the kernel indicate that the host did not read the socket fast enough, whereas datagrams lost
+ * on the network only show up as incomplete scan rounds.
+ *
+ * @see protocol_layer::MonitoringFrameStatistics
+ */
+struct ReceiveStatistics
+{
+  //! Datagrams passed to the message callback.
+  uint64_t datagrams{ 0 };
+  //! Bytes of the datagrams passed to the message callback.
+  uint64_t bytes{ 0 };
+  //! Datagrams dropped by the kernel because the receive buffer of the socket was full (SO_RXQ_OVFL).
+  uint64_t kernel_drops{ 0 };
+  //! Calls of the error callback.
+  uint64_t errors{ 0 };
+  //! Largest number of datagrams read from the socket at once.
+  std::size_t max_batch_size{ 0 };
+};
+
+}  // namespace communication_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_RECEIVE_STATISTICS_H
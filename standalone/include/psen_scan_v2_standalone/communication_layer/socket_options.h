@@ -0,0 +1,180 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_SOCKET_OPTIONS_H
+#define PSEN_SCAN_V2_STANDALONE_SOCKET_OPTIONS_H
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+
+#include <boost/optional.hpp>
+
+namespace psen_scan_v2_standalone
+{
+namespace communication_layer
+{
+/**
+ * @brief Options applied to the socket of an UdpClientImpl to tune receive latency and loss.
+ *
+ * Options which are not set keep the defaults of the operating system. The kernel might limit the requested values,
+ * the values actually applied are returned by UdpClientImpl::applySocketOptions().
+ *
+ * @note The options are only supported on Linux.
+ */
+class SocketOptions
+{
+public:
+  /**
+   * @brief Sets the size of the kernel receive buffer (SO_RCVBUF).
+   *
+   * A larger buffer prevents the loss of frames while the receiving thread is busy. The size is limited by
+   * net.core.rmem_max, the kernel doubles the applied value for its bookkeeping.
+   *
+   * @throws std::invalid_argument if bytes is not positive.
+   */
+  SocketOptions& receiveBufferSize(const int& bytes);
+  /**
+   * @brief Sets the time the kernel busy polls the network device for new datagrams on a blocking receive
+   * (SO_BUSY_POLL).
+   *
+   * @throws std::invalid_argument if duration is negative.
+   */
+  SocketOptions& busyPoll(const std::chrono::microseconds& duration);
+  /**
+   * @brief Sets the priority of the datagrams sent via the socket (SO_PRIORITY).
+   *
+   * @throws std::invalid_argument if priority is negative.
+   */
+  SocketOptions& priority(const int& priority);
+  /**
+   * @brief Sets the differentiated services code point the datagrams sent via the socket are marked with (IP_TOS).
+   *
+   * @throws std::invalid_argument if dscp exceeds 63.
+   */
+  SocketOptions& dscp(const uint8_t& dscp);
+  /**
+   * @brief Reports all ICMP errors, like an unreachable host, via the error callback of the client (IP_RECVERR).
+   *
+   * Without this option only a refused connection is reported.
+   */
+  SocketOptions& enableReceiveErrors(const bool& enable = true);
+
+  const boost::optional<int>& receiveBufferSize() const;
+  const boost::optional<std::chrono::microseconds>& busyPoll() const;
+  const boost::optional<int>& priority() const;
+  const boost::optional<uint8_t>& dscp() const;
+  const boost::optional<bool>& receiveErrorsEnabled() const;
+
+  bool operator==(const SocketOptions& rhs) const;
+  bool operator!=(const SocketOptions& rhs) const;
+
+public:
+  static constexpr uint8_t MAX_DSCP{ 63 };
+
+private:
+  boost::optional<int> receive_buffer_size_;
+  boost::optional<std::chrono::microseconds> busy_poll_;
+  boost::optional<int> priority_;
+  boost::optional<uint8_t> dscp_;
+  boost::optional<bool> receive_errors_;
+};
+
+inline SocketOptions& SocketOptions::receiveBufferSize(const int& bytes)
+{
+  if (bytes <= 0)
+  {
+    throw std::invalid_argument("Receive buffer size has to be positive.");
+  }
+  receive_buffer_size_ = bytes;
+  return *this;
+}
+
+inline SocketOptions& SocketOptions::busyPoll(const std::chrono::microseconds& duration)
+{
+  if (duration.count() < 0)
+  {
+    throw std::invalid_argument("Busy poll duration must not be negative.");
+  }
+  busy_poll_ = duration;
+  return *this;
+}
+
+inline SocketOptions& SocketOptions::priority(const int& priority)
+{
+  if (priority < 0)
+  {
+    throw std::invalid_argument("Socket priority must not be negative.");
+  }
+  priority_ = priority;
+  return *this;
+}
+
+inline SocketOptions& SocketOptions::dscp(const uint8_t& dscp)
+{
+  if (dscp > MAX_DSCP)
+  {
+    throw std::invalid_argument("DSCP has to be between 0 and 63.");
+  }
+  dscp_ = dscp;
+  return *this;
+}
+
+inline SocketOptions& SocketOptions::enableReceiveErrors(const bool& enable)
+{
+  receive_errors_ = enable;
+  return *this;
+}
+
+inline const boost::optional<int>& SocketOptions::receiveBufferSize() const
+{
+  return receive_buffer_size_;
+}
+
+inline const boost::optional<std::chrono::microseconds>& SocketOptions::busyPoll() const
+{
+  return busy_poll_;
+}
+
+inline const boost::optional<int>& SocketOptions::priority() const
+{
+  return priority_;
+}
+
+inline const boost::optional<uint8_t>& SocketOptions::dscp() const
+{
+  return dscp_;
+}
+
+inline const boost::optional<bool>& SocketOptions::receiveErrorsEnabled() const
+{
+  return receive_errors_;
+}
+
+inline bool SocketOptions::operator==(const SocketOptions& rhs) const
+{
+  return receive_buffer_size_ == rhs.receive_buffer_size_ && busy_poll_ == rhs.busy_poll_ &&
+         priority_ == rhs.priority_ && dscp_ == rhs.dscp_ && receive_errors_ == rhs.receive_errors_;
+}
+
+inline bool SocketOptions::operator!=(const SocketOptions& rhs) const
+{
+  return !(*this == rhs);
+}
+
+}  // namespace communication_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_SOCKET_OPTIONS_H
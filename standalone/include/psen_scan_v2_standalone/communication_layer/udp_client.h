@@ -15,6 +15,9 @@
 #ifndef PSEN_SCAN_V2_STANDALONE_UDP_CLIENT_H
 #define PSEN_SCAN_V2_STANDALONE_UDP_CLIENT_H
 
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -22,9 +25,17 @@
 #include <string>
 #include <thread>
 #include <future>
+#include <vector>
 
 #ifdef __linux__
 #include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <linux/errqueue.h>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
 #endif
 
 #ifdef _WIN32
@@ -34,8 +45,13 @@
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
 
+#include "psen_scan_v2_standalone/communication_layer/io_uring_receiver.h"
+#include "psen_scan_v2_standalone/communication_layer/receive_buffer_pool.h"
+#include "psen_scan_v2_standalone/communication_layer/receive_statistics.h"
+#include "psen_scan_v2_standalone/communication_layer/socket_options.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
 #include "psen_scan_v2_standalone/util/logging.h"
+#include "psen_scan_v2_standalone/util/thread_scheduling.h"
 #include "psen_scan_v2_standalone/util/timestamp.h"
 
 namespace psen_scan_v2_standalone
@@ -58,7 +74,15 @@ enum class ReceiveMode
   single,
   //! @brief Continuously wait for new messages. In other words, after a message is received, automatically start
   //! listening for the next message.
-  continuous
+  continuous,
+  //! @brief Like continuous, but on every wakeup all datagrams waiting in the socket are drained at once via
+  //! recvmmsg(). This saves a syscall and a handler dispatch per datagram if the scanner sends its frames in bursts.
+  //! Only available on Linux, on other platforms the same as continuous.
+  continuous_batched,
+  //! @brief Like continuous, but the datagrams are received by a multishot receive of io_uring into buffers registered
+  //! with the kernel. A wakeup only reads the completions from memory shared with the kernel, so no syscall per
+  //! datagram is needed. Requires Linux 6.0, falls back to continuous_batched if io_uring is not available.
+  continuous_io_uring
 };
 
 /**
@@ -69,6 +93,13 @@ enum class ReceiveMode
  * something goes wrong an
  * @ref ErrorCallback is invoked.
  *
+ * The data are received into the buffers of a ReceiveBufferPool. A buffer passed to the @ref NewMessageCallback is not
+ * reused before all copies of its pointer are released, so it can be kept beyond the callback without copying it.
+ *
+ * By default each client runs its own io_service in a dedicated thread. Alternatively an io_service can be passed to
+ * the constructor, which allows several clients to share a fixed number of threads, see IoServiceThreadPool. All
+ * operations on the socket and all callbacks of one client are serialized on a strand in both cases.
+ *
  * The ScannerV2 constructs two UDP clients, which are then used by the scanner_protocol::ScannerProtocolDef.
  */
 class UdpClientImpl
@@ -104,12 +135,17 @@ public:
    * @param host_port Port from which data are sent and received.
    * @param endpoint_ip IP address of the endpoint from which data are received and sent too.
    * @param endpoint_port Port on which the other endpoint is sending and receiving data.
+   * @param max_datagram_size Size of the receive buffers. Larger datagrams are reported via the error callback.
+   * @param io_service Runs the handlers of the client if given. It has to be run by at least one other thread until
+   * the client is closed. If nullptr, the client runs its own io_service in a dedicated thread.
    */
   UdpClientImpl(const NewMessageCallback& msg_callback,
                 const ErrorCallback& error_callback,
                 const unsigned short& host_port,
                 const unsigned int& endpoint_ip,
-                const unsigned short& endpoint_port);
+                const unsigned short& endpoint_port,
+                const std::size_t max_datagram_size = data_conversion_layer::MAX_UDP_PAKET_SIZE,
+                boost::asio::io_service* io_service = nullptr);
 
   /**
    * @brief Closes the UDP connection and stops all pending asynchronous operation.
@@ -127,15 +163,69 @@ public:
    */
   void startAsyncReceiving(const ReceiveMode& modi = ReceiveMode::continuous);
 
+  /**
+   * @brief Stamps received messages with their arrival time in the kernel instead of the time they are dispatched.
+   *
+   * Enables SO_TIMESTAMPNS on the socket, so the timestamp passed to the @ref NewMessageCallback does not contain the
+   * delay until the io_service thread gets scheduled. Has to be called before startAsyncReceiving().
+   *
+   * @returns false if kernel timestamps are not supported. The time of dispatch is used in this case.
+   */
+  bool enableKernelTimestamps();
+
+  /**
+   * @brief Counts the datagrams dropped by the kernel because the receive buffer of the socket was full.
+   *
+   * Enables SO_RXQ_OVFL on the socket, the count is reported in ReceiveStatistics::kernel_drops. Has to be called
+   * before startAsyncReceiving().
+   *
+   * @returns false if the drop counter is not supported.
+   */
+  bool enableKernelDropCounter();
+
+  /**
+   * @brief Returns the counters of the datagrams received so far.
+   *
+   * Can be called from any thread while receiving.
+   */
+  ReceiveStatistics receiveStatistics() const;
+
+  /**
+   * @brief Applies the given options to the socket.
+   *
+   * Options which cannot be applied, for example due to missing permissions, are skipped with a warning.
+   *
+   * @returns The values read back from the socket for all options which were applied. The kernel might have limited
+   * the requested values.
+   */
+  SocketOptions applySocketOptions(const SocketOptions& options);
+
+  /**
+   * @brief Applies the CPU affinity and real-time scheduling to the thread receiving and processing the data.
+   *
+   * Settings which cannot be applied, for example due to a missing CAP_SYS_NICE, are skipped with a warning. The
+   * threads of an io_service passed to the constructor are not affected, see IoServiceThreadPool instead.
+   *
+   * @returns false if any of the settings could not be applied.
+   */
+  bool applyThreadScheduling(const util::ThreadScheduling& scheduling);
+
   /**
    * @brief Asynchronously sends the specified data to the other endpoint.
    *
    * @param data Data which have to be send to the other endpoint.
    */
   void write(const data_conversion_layer::RawData& data);
+  /**
+   * @brief Asynchronously sends the specified data to the other endpoint without copying them.
+   *
+   * The client shares ownership of the data until they were sent, so data which are sent repeatedly can be serialized
+   * once. The data must not be modified while they are shared.
+   */
+  void write(const data_conversion_layer::RawDataConstPtr& data);
 
   /**
-   * @brief Stops the underlying io_service so that no messages are received anymore.
+   * @brief Cancels all pending asynchronous operations so that no messages are received anymore.
    *
    * Note: In contrary to close() this is non-blocking but note that after calling stop()
    * calls to the msg_callback are still possible due to pending messages.
@@ -144,6 +234,8 @@ public:
 
   /**
    * @brief Closes the UDP connection and stops all pending asynchronous operation.
+   *
+   * Blocks until all handlers referring to the client have finished.
    */
   void close();
 
@@ -154,16 +246,94 @@ public:
 
 private:
   void asyncReceive(const ReceiveMode& modi);
+  void handleReceivedData(const data_conversion_layer::RawDataPtr& data,
+                          const std::size_t& bytes_received,
+                          const int64_t& timestamp);
+  void reportReceiveError(const std::string& message);
+  void updateMaxBatchSize(const std::size_t& batch_size);
+#ifdef __linux__
+  template <typename Handler>
+  void asyncWaitUntilReadable(const Handler& handler);
+  void asyncReceiveBatch();
+  void receiveBatch();
+  void asyncReceiveWithControlMessages(const ReceiveMode& modi);
+  bool receiveWithControlMessages();
+  bool controlMessagesEnabled() const;
+  //! @brief Takes over the kernel timestamp and drop count attached to msg.
+  //! @param timestamp Left unchanged if no kernel timestamp is attached.
+  void evaluateControlMessages(msghdr& msg, int64_t& timestamp);
+  //! @brief Sets an integer socket option and reads back the value applied by the kernel.
+  bool setSocketOption(const int& level, const int& name, const char* option_name, const int& value, int& applied);
+  void drainErrorQueue();
+#endif
+#ifdef PSEN_SCAN_V2_STANDALONE_IO_URING_SUPPORTED
+  //! @returns false if io_uring is not available.
+  bool startIoUringReceive();
+  void asyncWaitForIoUringCompletions();
+  void processIoUringCompletions();
+  void stopIoUringReceive();
+#endif
 
   void sendCompleteHandler(const boost::system::error_code& error, std::size_t bytes_transferred);
 
+  //! @brief Binds a copy of handler_guard_ to the handler, so that close() waits until the handler was executed.
+  template <typename Handler>
+  auto guarded(const Handler& handler);
+
 private:
-  boost::asio::io_service io_service_;
-  // Prevent the run() method of the io_service from returning when there is no more work.
-  boost::asio::io_service::work work_{ io_service_ };
+  //! Only used if no io_service is passed to the constructor.
+  std::unique_ptr<boost::asio::io_service> own_io_service_;
+  boost::asio::io_service& io_service_;
+  // Prevent the run() method of the own io_service from returning when there is no more work.
+  std::unique_ptr<boost::asio::io_service::work> work_;
   std::thread io_service_thread_;
+  //! Serializes the operations on the socket, the io_service might be run by several threads.
+  boost::asio::io_service::strand strand_;
+
+  //! Copied into every handler referring to the client. Released by close(), handlers_released_ becomes ready once
+  //! the last handler was executed.
+  std::shared_ptr<void> handler_guard_;
+  std::future<void> handlers_released_;
+  //! Only accessed on the strand.
+  bool receiving_stopped_{ false };
+  bool closed_{ false };
+
+  //! Enough buffers to receive the next datagram while the consumer still holds on to the previous ones.
+  static constexpr std::size_t NUMBER_OF_RECEIVE_BUFFERS{ 4 };
+  //! Each buffer has space for one byte more than max_datagram_size_, so that too large datagrams can be detected.
+  std::shared_ptr<ReceiveBufferPool> receive_buffers_;
+  std::size_t max_datagram_size_;
+
+#ifdef __linux__
+  //! Maximal number of datagrams read by one recvmmsg() call in ReceiveMode::continuous_batched.
+  static constexpr std::size_t RECEIVE_BATCH_SIZE{ 16 };
+  //! Buffers of ReceiveMode::continuous_batched, each is replaced by a new one from the pool once it was passed on.
+  std::vector<data_conversion_layer::RawDataPtr> batch_data_;
+
+  //! Space for the control messages carrying the kernel timestamp and the drop count of a datagram.
+  struct ControlBuffer
+  {
+    alignas(cmsghdr) char data[CMSG_SPACE(sizeof(timespec)) + CMSG_SPACE(sizeof(uint32_t))];
+  };
+  bool kernel_timestamps_{ false };
+  bool kernel_drop_counter_{ false };
+  bool receive_errors_{ false };
+#endif
 
-  data_conversion_layer::RawDataPtr received_data_;
+#ifdef PSEN_SCAN_V2_STANDALONE_IO_URING_SUPPORTED
+  //! Only used in ReceiveMode::continuous_io_uring.
+  std::unique_ptr<IoUringReceiver> io_uring_receiver_;
+  //! Waits until the ring has completions, does not own the file descriptor of the ring.
+  std::unique_ptr<boost::asio::posix::stream_descriptor> io_uring_descriptor_;
+  bool io_uring_wait_pending_{ false };
+#endif
+
+  //! Written only by the io_service thread, read by receiveStatistics() from any thread.
+  std::atomic<uint64_t> datagrams_{ 0 };
+  std::atomic<uint64_t> bytes_{ 0 };
+  std::atomic<uint64_t> kernel_drops_{ 0 };
+  std::atomic<uint64_t> errors_{ 0 };
+  std::atomic<std::size_t> max_batch_size_{ 0 };
 
   NewMessageCallback message_callback_;
   ErrorCallback error_callback_;
@@ -176,8 +346,14 @@ inline communication_layer::UdpClientImpl::UdpClientImpl(const NewMessageCallbac
                                                          const ErrorCallback& error_callback,
                                                          const unsigned short& host_port,
                                                          const unsigned int& endpoint_ip,
-                                                         const unsigned short& endpoint_port)
-  : message_callback_(message_callback)
+                                                         const unsigned short& endpoint_port,
+                                                         const std::size_t max_datagram_size,
+                                                         boost::asio::io_service* io_service)
+  : own_io_service_(io_service ? nullptr : new boost::asio::io_service())
+  , io_service_(io_service ? *io_service : *own_io_service_)
+  , strand_(io_service_)
+  , max_datagram_size_(max_datagram_size)
+  , message_callback_(message_callback)
   , error_callback_(error_callback)
   , socket_(io_service_, boost::asio::ip::udp::endpoint(boost::asio::ip::udp::v4(), host_port))
   , endpoint_(boost::asio::ip::address_v4(endpoint_ip), endpoint_port)
@@ -192,7 +368,12 @@ inline communication_layer::UdpClientImpl::UdpClientImpl(const NewMessageCallbac
     throw std::invalid_argument("Error callback is invalid");
   }
 
-  received_data_.reset(new data_conversion_layer::RawData(data_conversion_layer::MAX_UDP_PAKET_SIZE));
+  receive_buffers_ = ReceiveBufferPool::create(NUMBER_OF_RECEIVE_BUFFERS, max_datagram_size_ + 1);
+  const auto handlers_released{ std::make_shared<std::promise<void>>() };
+  handlers_released_ = handlers_released->get_future();
+  handler_guard_ = std::shared_ptr<void>(nullptr, [handlers_released](void* /*unused*/) {
+    handlers_released->set_value();
+  });
   try
   {
     socket_.connect(endpoint_);
@@ -205,36 +386,73 @@ inline communication_layer::UdpClientImpl::UdpClientImpl(const NewMessageCallbac
   }
   // LCOV_EXCL_STOP
 
-  assert(!io_service_thread_.joinable() && "io_service_thread_ is joinable!");
-  io_service_thread_ = std::thread([this]() { io_service_.run(); });
+  if (own_io_service_)
+  {
+    work_.reset(new boost::asio::io_service::work(io_service_));
+    assert(!io_service_thread_.joinable() && "io_service_thread_ is joinable!");
+    io_service_thread_ = std::thread([this]() { io_service_.run(); });
+  }
+}
+
+template <typename Handler>
+inline auto UdpClientImpl::guarded(const Handler& handler)
+{
+  return [handler, guard = handler_guard_](const auto&... args) {
+    static_cast<void>(guard);
+    handler(args...);
+  };
 }
 
 inline void UdpClientImpl::stop()
 {
-  io_service_.stop();
+  strand_.post(guarded([this]() {
+    receiving_stopped_ = true;
+    boost::system::error_code ignored_error;
+    socket_.cancel(ignored_error);
+#ifdef PSEN_SCAN_V2_STANDALONE_IO_URING_SUPPORTED
+    if (io_uring_receiver_)
+    {
+      io_uring_receiver_->cancel();
+    }
+#endif
+  }));
 }
 
 inline void UdpClientImpl::close()
 {
-  io_service_.stop();
-  if (io_service_thread_.joinable())
+  if (closed_)
   {
-    io_service_thread_.join();
+    return;
   }
+  closed_ = true;
 
-  try
+  // Function is intended to be called from the main thread. To avoid concurrency issues, the socket is closed on the
+  // strand. This aborts all pending operations, afterwards no new handlers are created.
+  boost::system::error_code close_error;
+  strand_.post([this, &close_error]() {
+    receiving_stopped_ = true;
+#ifdef PSEN_SCAN_V2_STANDALONE_IO_URING_SUPPORTED
+    stopIoUringReceive();
+#endif
+    socket_.close(close_error);
+    handler_guard_.reset();
+  });
+  handlers_released_.wait();
+
+  if (own_io_service_)
   {
-    // Function is intended to be called from the main thread,
-    // therefore, the following socket operation happens on the main thread.
-    // To avoid concurrency issues, it has to be ensured that the io_service thread
-    // is finished before the socket close operation is performed.
-    socket_.close();
+    io_service_.stop();
+    if (io_service_thread_.joinable())
+    {
+      io_service_thread_.join();
+    }
   }
+
   // LCOV_EXCL_START
   // No coverage check because testing the socket is not the objective here.
-  catch (const boost::system::system_error& ex)
+  if (close_error)
   {
-    throw CloseConnectionFailure(ex.what());
+    throw CloseConnectionFailure(close_error.message());
   }
   // LCOV_EXCL_STOP
 }
@@ -261,6 +479,10 @@ inline UdpClientImpl::~UdpClientImpl()
 
 inline void UdpClientImpl::sendCompleteHandler(const boost::system::error_code& error, std::size_t bytes_transferred)
 {
+  if (error == boost::asio::error::operation_aborted)
+  {
+    return;
+  }
   // LCOV_EXCL_START
   // No coverage check because testing the if-loop is extremly difficult.
   if (error || bytes_transferred == 0)
@@ -274,13 +496,19 @@ inline void UdpClientImpl::sendCompleteHandler(const boost::system::error_code&
 
 inline void UdpClientImpl::write(const data_conversion_layer::RawData& data)
 {
-  io_service_.post([this, data]() {
-    socket_.async_send(boost::asio::buffer(data.data(), data.size()),
-                       boost::bind(&UdpClientImpl::sendCompleteHandler,
-                                   this,
-                                   boost::asio::placeholders::error,
-                                   boost::asio::placeholders::bytes_transferred));
-  });
+  write(std::make_shared<const data_conversion_layer::RawData>(data));
+}
+
+inline void UdpClientImpl::write(const data_conversion_layer::RawDataConstPtr& data)
+{
+  // The send completion handler holds on to the data, so they stay valid until they were sent.
+  strand_.post(guarded([this, data]() {
+    socket_.async_send(boost::asio::buffer(data->data(), data->size()),
+                       strand_.wrap(guarded([this, data](const boost::system::error_code& error,
+                                                         const std::size_t& bytes_transferred) {
+                         sendCompleteHandler(error, bytes_transferred);
+                       })));
+  }));
 }
 
 inline void UdpClientImpl::startAsyncReceiving(const ReceiveMode& modi)
@@ -288,34 +516,517 @@ inline void UdpClientImpl::startAsyncReceiving(const ReceiveMode& modi)
   std::promise<void> post_done_barrier;
   const auto post_done_future{ post_done_barrier.get_future() };
   // Function is intended to be called from main thread.
-  // To ensure that socket operations only happen on one strand (in this case an implicit one),
-  // the asyncReceive() operation is scheduled as task to the io_service thread.
-  io_service_.post([this, modi, &post_done_barrier]() {
+  // To ensure that socket operations only happen on one strand,
+  // the asyncReceive() operation is scheduled as task to the strand.
+  strand_.post([this, modi, &post_done_barrier]() {
     asyncReceive(modi);
     post_done_barrier.set_value();
   });
   post_done_future.wait();
 }
 
+inline bool UdpClientImpl::enableKernelTimestamps()
+{
+#ifdef __linux__
+  const int enable{ 1 };
+  if (::setsockopt(socket_.native_handle(), SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) != 0)
+  {
+    return false;  // LCOV_EXCL_LINE Supported by all Linux kernels the driver runs on.
+  }
+  kernel_timestamps_ = true;
+  return true;
+#else
+  return false;
+#endif
+}
+
+inline bool UdpClientImpl::enableKernelDropCounter()
+{
+#ifdef __linux__
+  const int enable{ 1 };
+  if (::setsockopt(socket_.native_handle(), SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable)) != 0)
+  {
+    return false;  // LCOV_EXCL_LINE Supported by all Linux kernels the driver runs on.
+  }
+  kernel_drop_counter_ = true;
+  return true;
+#else
+  return false;
+#endif
+}
+
+inline ReceiveStatistics UdpClientImpl::receiveStatistics() const
+{
+  ReceiveStatistics statistics;
+  statistics.datagrams = datagrams_.load(std::memory_order_relaxed);
+  statistics.bytes = bytes_.load(std::memory_order_relaxed);
+  statistics.kernel_drops = kernel_drops_.load(std::memory_order_relaxed);
+  statistics.errors = errors_.load(std::memory_order_relaxed);
+  statistics.max_batch_size = max_batch_size_.load(std::memory_order_relaxed);
+  return statistics;
+}
+
+inline SocketOptions UdpClientImpl::applySocketOptions(const SocketOptions& options)
+{
+  SocketOptions applied;
+#ifdef __linux__
+  int value{ 0 };
+  if (options.receiveBufferSize() &&
+      setSocketOption(SOL_SOCKET, SO_RCVBUF, "SO_RCVBUF", *options.receiveBufferSize(), value))
+  {
+    applied.receiveBufferSize(value);
+  }
+  if (options.busyPoll() &&
+      setSocketOption(SOL_SOCKET, SO_BUSY_POLL, "SO_BUSY_POLL", options.busyPoll()->count(), value))
+  {
+    applied.busyPoll(std::chrono::microseconds(value));
+  }
+  if (options.priority() && setSocketOption(SOL_SOCKET, SO_PRIORITY, "SO_PRIORITY", *options.priority(), value))
+  {
+    applied.priority(value);
+  }
+  // The DSCP occupies the upper six bits of the type of service field.
+  if (options.dscp() && setSocketOption(IPPROTO_IP, IP_TOS, "IP_TOS", *options.dscp() << 2, value))
+  {
+    applied.dscp(static_cast<uint8_t>(value >> 2));
+  }
+  if (options.receiveErrorsEnabled() &&
+      setSocketOption(IPPROTO_IP, IP_RECVERR, "IP_RECVERR", *options.receiveErrorsEnabled() ? 1 : 0, value))
+  {
+    receive_errors_ = value != 0;
+    applied.enableReceiveErrors(receive_errors_);
+  }
+#else
+  if (options != SocketOptions())
+  {
+    PSENSCAN_WARN("UdpClient", "Socket options are only supported on Linux.");
+  }
+#endif
+  return applied;
+}
+
+inline bool UdpClientImpl::applyThreadScheduling(const util::ThreadScheduling& scheduling)
+{
+  if (scheduling == util::ThreadScheduling())
+  {
+    return true;
+  }
+  if (!own_io_service_)
+  {
+    PSENSCAN_WARN("UdpClient", "Scheduling of the threads of a shared io_service has to be set by its owner.");
+    return false;
+  }
+  return util::applyThreadScheduling(
+      io_service_thread_, scheduling, "UdpClient " + std::to_string(socket_.local_endpoint().port()));
+}
+
 inline void UdpClientImpl::asyncReceive(const ReceiveMode& modi)
 {
-  socket_.async_receive(boost::asio::buffer(*received_data_, received_data_->size()),
-                        [this, modi](const boost::system::error_code& error_code, const std::size_t& bytes_received) {
-                          if (error_code || bytes_received == 0)
-                          {
-                            error_callback_(error_code.message());
-                          }
-                          else
-                          {
-                            message_callback_(received_data_, bytes_received, util::getCurrentTime());
-                          }
-                          if (modi == ReceiveMode::continuous)
-                          {
-                            asyncReceive(modi);
-                          }
-                        });
+#ifdef PSEN_SCAN_V2_STANDALONE_IO_URING_SUPPORTED
+  if (modi == ReceiveMode::continuous_io_uring && (io_uring_receiver_ || startIoUringReceive()))
+  {
+    return;
+  }
+#endif
+#ifdef __linux__
+  if (modi == ReceiveMode::continuous_batched || modi == ReceiveMode::continuous_io_uring)
+  {
+    if (batch_data_.empty())
+    {
+      // A whole batch might be held by the consumer while the next one is received.
+      receive_buffers_ = ReceiveBufferPool::create(2 * RECEIVE_BATCH_SIZE, max_datagram_size_ + 1);
+      batch_data_.resize(RECEIVE_BATCH_SIZE);
+    }
+    asyncReceiveBatch();
+    return;
+  }
+  if (controlMessagesEnabled())
+  {
+    asyncReceiveWithControlMessages(modi);
+    return;
+  }
+#endif
+  const data_conversion_layer::RawDataPtr received_data{ receive_buffers_->acquire() };
+  socket_.async_receive(
+      boost::asio::buffer(*received_data, received_data->size()),
+      strand_.wrap(guarded([this, modi, received_data](const boost::system::error_code& error_code,
+                                                       const std::size_t& bytes_received) {
+        if (error_code == boost::asio::error::operation_aborted)
+        {
+          return;  // Stopped or closed.
+        }
+        if (error_code || bytes_received == 0)
+        {
+          reportReceiveError(error_code.message());
+        }
+        else
+        {
+          updateMaxBatchSize(1);
+          handleReceivedData(received_data, bytes_received, util::getCurrentTime());
+        }
+        if (modi == ReceiveMode::continuous && !receiving_stopped_)
+        {
+          asyncReceive(modi);
+        }
+      })));
+}
+
+inline void UdpClientImpl::handleReceivedData(const data_conversion_layer::RawDataPtr& data,
+                                              const std::size_t& bytes_received,
+                                              const int64_t& timestamp)
+{
+  // A datagram filling the spare byte of the buffer was truncated.
+  if (bytes_received > max_datagram_size_)
+  {
+    reportReceiveError("Received datagram exceeds the maximal size of " + std::to_string(max_datagram_size_) +
+                       " bytes");
+    return;
+  }
+  datagrams_.fetch_add(1, std::memory_order_relaxed);
+  bytes_.fetch_add(bytes_received, std::memory_order_relaxed);
+  message_callback_(data, bytes_received, timestamp);
+}
+
+inline void UdpClientImpl::reportReceiveError(const std::string& message)
+{
+#ifdef __linux__
+  if (receive_errors_)
+  {
+    // The error itself is reported by the failing receive, only the queued details have to be discarded.
+    drainErrorQueue();
+  }
+#endif
+  errors_.fetch_add(1, std::memory_order_relaxed);
+  error_callback_(message);
+}
+
+inline void UdpClientImpl::updateMaxBatchSize(const std::size_t& batch_size)
+{
+  // There is only one writer, so no compare-exchange is needed.
+  if (batch_size > max_batch_size_.load(std::memory_order_relaxed))
+  {
+    max_batch_size_.store(batch_size, std::memory_order_relaxed);
+  }
+}
+
+#ifdef __linux__
+template <typename Handler>
+inline void UdpClientImpl::asyncWaitUntilReadable(const Handler& handler)
+{
+  // Aborted waits are dropped, so the handler is not called once the client was stopped or closed.
+  const auto on_readable{ [this, handler](const boost::system::error_code& error_code) {
+    if (error_code != boost::asio::error::operation_aborted && !receiving_stopped_)
+    {
+      handler(error_code);
+    }
+  } };
+#if BOOST_VERSION >= 106600
+  socket_.async_wait(boost::asio::ip::udp::socket::wait_read, strand_.wrap(guarded(on_readable)));
+#else
+  socket_.async_receive(boost::asio::null_buffers(),
+                        strand_.wrap(guarded([on_readable](const boost::system::error_code& error_code,
+                                                           const std::size_t& /*unused*/) {
+                          on_readable(error_code);
+                        })));
+#endif
+}
+
+inline void UdpClientImpl::asyncReceiveBatch()
+{
+  // Only waits until the socket is readable, the datagrams are read by receiveBatch().
+  asyncWaitUntilReadable([this](const boost::system::error_code& error_code) {
+    if (error_code)
+    {
+      reportReceiveError(error_code.message());
+    }
+    else
+    {
+      receiveBatch();
+    }
+    asyncReceiveBatch();
+  });
+}
+
+inline void UdpClientImpl::receiveBatch()
+{
+  std::array<iovec, RECEIVE_BATCH_SIZE> iovecs;
+  std::array<mmsghdr, RECEIVE_BATCH_SIZE> msgs{};
+  std::array<ControlBuffer, RECEIVE_BATCH_SIZE> control_buffers;
+
+  // Drain the socket, a completely filled batch indicates that more datagrams might be waiting.
+  int num_received{ static_cast<int>(RECEIVE_BATCH_SIZE) };
+  while (num_received == static_cast<int>(RECEIVE_BATCH_SIZE))
+  {
+    for (std::size_t i = 0; i < RECEIVE_BATCH_SIZE; ++i)
+    {
+      if (!batch_data_[i])
+      {
+        batch_data_[i] = receive_buffers_->acquire();
+      }
+      iovecs[i].iov_base = batch_data_[i]->data();
+      iovecs[i].iov_len = batch_data_[i]->size();
+      msgs[i].msg_hdr.msg_iov = &iovecs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+      if (controlMessagesEnabled())
+      {
+        msgs[i].msg_hdr.msg_control = control_buffers[i].data;
+        msgs[i].msg_hdr.msg_controllen = sizeof(control_buffers[i].data);
+      }
+    }
+
+    num_received = ::recvmmsg(socket_.native_handle(), msgs.data(), RECEIVE_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+    if (num_received < 0)
+    {
+      // LCOV_EXCL_START
+      // No coverage check because other errors than an empty socket cannot be provoked in a test.
+      if (errno != EAGAIN && errno != EWOULDBLOCK)
+      {
+        reportReceiveError(std::strerror(errno));
+      }
+      // LCOV_EXCL_STOP
+      return;
+    }
+
+    updateMaxBatchSize(num_received);
+    // All datagrams of the batch were already received when recvmmsg() returned.
+    const int64_t dispatch_time{ util::getCurrentTime() };
+    for (int i = 0; i < num_received; ++i)
+    {
+      if (msgs[i].msg_len == 0)
+      {
+        reportReceiveError("Received empty datagram");
+      }
+      else
+      {
+        int64_t timestamp{ dispatch_time };
+        if (controlMessagesEnabled())
+        {
+          evaluateControlMessages(msgs[i].msg_hdr, timestamp);
+        }
+        handleReceivedData(batch_data_[i], msgs[i].msg_len, timestamp);
+        // The consumer might still use the buffer, so it is replaced before the next recvmmsg() call.
+        batch_data_[i].reset();
+      }
+    }
+  }
 }
 
+inline void UdpClientImpl::asyncReceiveWithControlMessages(const ReceiveMode& modi)
+{
+  // Only waits until the socket is readable, the datagram is read by receiveWithControlMessages() together with its
+  // control messages.
+  asyncWaitUntilReadable([this, modi](const boost::system::error_code& error_code) {
+    bool received{ true };
+    if (error_code)
+    {
+      reportReceiveError(error_code.message());
+    }
+    else
+    {
+      received = receiveWithControlMessages();
+    }
+    // Nothing was received on a spurious wakeup, so even a single receive has to wait again.
+    if (!received || modi == ReceiveMode::continuous)
+    {
+      asyncReceiveWithControlMessages(modi);
+    }
+  });
+}
+
+inline bool UdpClientImpl::receiveWithControlMessages()
+{
+  const data_conversion_layer::RawDataPtr received_data{ receive_buffers_->acquire() };
+  iovec iov{ received_data->data(), received_data->size() };
+  ControlBuffer control_buffer;
+  msghdr msg{};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control_buffer.data;
+  msg.msg_controllen = sizeof(control_buffer.data);
+
+  const ssize_t bytes_received{ ::recvmsg(socket_.native_handle(), &msg, MSG_DONTWAIT) };
+  if (bytes_received < 0)
+  {
+    // LCOV_EXCL_START
+    // No coverage check because other errors than an empty socket cannot be provoked in a test.
+    if (errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+      reportReceiveError(std::strerror(errno));
+      return true;
+    }
+    // LCOV_EXCL_STOP
+    return false;
+  }
+  if (bytes_received == 0)
+  {
+    reportReceiveError("Received empty datagram");
+  }
+  else
+  {
+    int64_t timestamp{ util::getCurrentTime() };
+    evaluateControlMessages(msg, timestamp);
+    updateMaxBatchSize(1);
+    handleReceivedData(received_data, bytes_received, timestamp);
+  }
+  return true;
+}
+
+inline bool UdpClientImpl::controlMessagesEnabled() const
+{
+  return kernel_timestamps_ || kernel_drop_counter_;
+}
+
+inline void UdpClientImpl::evaluateControlMessages(msghdr& msg, int64_t& timestamp)
+{
+  for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+  {
+    if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS)
+    {
+      timespec stamp;
+      std::memcpy(&stamp, CMSG_DATA(cmsg), sizeof(stamp));
+      timestamp = static_cast<int64_t>(stamp.tv_sec) * 1000000000 + stamp.tv_nsec;
+    }
+    else if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL)
+    {
+      // The kernel reports the number of drops since the socket was opened, it is attached once a drop occurred.
+      uint32_t drops;
+      std::memcpy(&drops, CMSG_DATA(cmsg), sizeof(drops));
+      kernel_drops_.store(drops, std::memory_order_relaxed);
+    }
+  }
+}
+
+inline bool UdpClientImpl::setSocketOption(
+    const int& level, const int& name, const char* option_name, const int& value, int& applied)
+{
+  const int fd{ socket_.native_handle() };
+  const unsigned short port{ socket_.local_endpoint().port() };
+  socklen_t length{ sizeof(applied) };
+  if (::setsockopt(fd, level, name, &value, sizeof(value)) != 0 ||
+      ::getsockopt(fd, level, name, &applied, &length) != 0)
+  {
+    PSENSCAN_WARN(
+        "UdpClient", "Could not set {} of socket {} to {}: {}", option_name, port, value, std::strerror(errno));
+    return false;
+  }
+  if (applied < value)
+  {
+    PSENSCAN_WARN("UdpClient", "{} of socket {} was limited to {} instead of {}.", option_name, port, applied, value);
+  }
+  else
+  {
+    PSENSCAN_INFO("UdpClient", "{} of socket {} set to {}.", option_name, port, applied);
+  }
+  return true;
+}
+
+inline void UdpClientImpl::drainErrorQueue()
+{
+  char control_buffer[CMSG_SPACE(sizeof(sock_extended_err) + sizeof(sockaddr_in))];
+  msghdr msg{};
+  do
+  {
+    msg.msg_control = control_buffer;
+    msg.msg_controllen = sizeof(control_buffer);
+  } while (::recvmsg(socket_.native_handle(), &msg, MSG_ERRQUEUE | MSG_DONTWAIT) >= 0);
+}
+#endif
+
+#ifdef PSEN_SCAN_V2_STANDALONE_IO_URING_SUPPORTED
+inline bool UdpClientImpl::startIoUringReceive()
+{
+  try
+  {
+    io_uring_receiver_.reset(new IoUringReceiver(socket_.native_handle(), max_datagram_size_, sizeof(ControlBuffer)));
+  }
+  catch (const IoUringReceiver::SetupFailure& ex)
+  {
+    PSENSCAN_WARN("UdpClient", "{}. Falling back to batched receive.", ex.what());
+    return false;
+  }
+  io_uring_descriptor_.reset(new boost::asio::posix::stream_descriptor(io_service_, io_uring_receiver_->fd()));
+  io_uring_receiver_->start();
+  asyncWaitForIoUringCompletions();
+  return true;
+}
+
+inline void UdpClientImpl::asyncWaitForIoUringCompletions()
+{
+  io_uring_wait_pending_ = true;
+  io_uring_descriptor_->async_wait(
+      boost::asio::posix::stream_descriptor::wait_read,
+      strand_.wrap(guarded([this](const boost::system::error_code& error_code) {
+        if (error_code == boost::asio::error::operation_aborted || !io_uring_receiver_)
+        {
+          return;  // Closed.
+        }
+        io_uring_wait_pending_ = false;
+        if (error_code)
+        {
+          reportReceiveError(error_code.message());  // LCOV_EXCL_LINE Waiting for the ring does not fail.
+        }
+        processIoUringCompletions();
+      })));
+}
+
+inline void UdpClientImpl::processIoUringCompletions()
+{
+  // The readiness of the ring is only signaled for completions posted after the wait was started, so the ring is
+  // checked again once the wait is pending.
+  do
+  {
+    const std::size_t datagrams{ io_uring_receiver_->processCompletions(
+        [this](const data_conversion_layer::RawDataPtr& data, const std::size_t& bytes_received, msghdr& control) {
+          int64_t timestamp{ util::getCurrentTime() };
+          if (controlMessagesEnabled())
+          {
+            evaluateControlMessages(control, timestamp);
+          }
+          if (bytes_received == 0)
+          {
+            reportReceiveError("Received empty datagram");
+          }
+          else
+          {
+            handleReceivedData(data, bytes_received, timestamp);
+          }
+        },
+        [this](const int& error_number) { reportReceiveError(std::strerror(error_number)); }) };
+    updateMaxBatchSize(datagrams);
+
+    if (!io_uring_receiver_->receiving())
+    {
+      if (!receiving_stopped_)
+      {
+        // LCOV_EXCL_START
+        // No coverage check because all kernels supporting the buffer ring support the multishot receive.
+        PSENSCAN_WARN("UdpClient", "Multishot receive is not supported. Falling back to batched receive.");
+        stopIoUringReceive();
+        asyncReceive(ReceiveMode::continuous_batched);
+        // LCOV_EXCL_STOP
+      }
+      return;
+    }
+    if (!io_uring_wait_pending_)
+    {
+      asyncWaitForIoUringCompletions();
+    }
+  } while (io_uring_receiver_->completionsPending());
+}
+
+inline void UdpClientImpl::stopIoUringReceive()
+{
+  if (io_uring_descriptor_)
+  {
+    // Cancels the pending wait without closing the ring.
+    io_uring_descriptor_->release();
+    io_uring_descriptor_.reset();
+  }
+  io_uring_receiver_.reset();
+  io_uring_wait_pending_ = false;
+}
+#endif
+
 inline UdpClientImpl::OpenConnectionFailure::OpenConnectionFailure(const std::string& msg) : std::runtime_error(msg)
 {
 }
@@ -16,6 +16,8 @@
 #ifndef PSEN_SCAN_V2_STANDALONE_DEFAULT_PARAMETERS_H
 #define PSEN_SCAN_V2_STANDALONE_DEFAULT_PARAMETERS_H
 
+#include <cstdint>
+
 #include "psen_scan_v2_standalone/data_conversion_layer/angle_conversions.h"
 #include "psen_scan_v2_standalone/util/tenth_of_degree.h"
 
@@ -49,6 +51,9 @@ static constexpr double RANGE_MAX_IN_M{ 40. };
 
 static constexpr unsigned short NR_SUBSCRIBERS{ 0 };
 
+//! @brief Maximal number of newer scan rounds an incomplete scan round is kept open for.
+static constexpr uint32_t MAX_SCAN_ROUND_REORDER_WINDOW{ 16 };
+
 static const util::TenthOfDegree DEFAULT_ZONESET_ANGLE_STEP(5);
 }  // namespace configuration
 
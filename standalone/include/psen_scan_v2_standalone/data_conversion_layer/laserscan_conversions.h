@@ -19,15 +19,21 @@
 #include "psen_scan_v2_standalone/configuration/default_parameters.h"
 #include "psen_scan_v2_standalone/configuration/scanner_ids.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/angle_conversions.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg.h"
 #include "psen_scan_v2_standalone/laserscan.h"
 
 #include "psen_scan_v2_standalone/util/logging.h"
 
 #include <algorithm>
-#include <numeric>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 namespace psen_scan_v2_standalone
 {
 namespace data_conversion_layer
@@ -41,6 +47,81 @@ public:
   ScannerProtocolViolationError(const std::string& msg) : std::runtime_error(msg){};
 };
 
+/**
+ * @brief Outcome of LaserScanConverter::tryToLaserScan() and LaserScanConverter::tryToPartialLaserScan().
+ */
+enum class ScanConversionStatus
+{
+  ok,
+  //! No monitoring frame was passed.
+  no_frames,
+  //! The monitoring frames have different resolutions.
+  resolutions_mismatch,
+  //! The resolution of the monitoring frames is not positive.
+  invalid_resolution,
+  //! The monitoring frames have different scan counters.
+  scan_counters_mismatch,
+  //! The ranges of the monitoring frames do not cover the whole scan range.
+  theta_angles_mismatch
+};
+
+std::string toString(const ScanConversionStatus& status);
+
+/**
+ * @brief Angles of the first and the last measurement of a scan.
+ */
+struct ScanAngles
+{
+  util::TenthOfDegree min_angle;
+  util::TenthOfDegree max_angle;
+};
+
+/**
+ * @brief Properties of the frames of a scan round, which are gathered in a single pass over the frames.
+ *
+ * @see summarizeFrames()
+ */
+struct FramesSummary
+{
+  //! Frames with measurements, frames without measurements are ignored.
+  std::size_t number_of_filled_frames{ 0 };
+  //! Indices of the filled frames with the smallest and the largest angle, and of the one received first.
+  std::size_t first_frame_index{ 0 };
+  std::size_t last_frame_index{ 0 };
+  std::size_t earliest_frame_index{ 0 };
+  std::size_t number_of_samples{ 0 };
+  //! Set if each filled frame has as many intensities as measurements.
+  bool all_frames_with_intensities{ true };
+};
+
+/**
+ * @brief Checks that the frames of a scan round share a positive resolution and their scan counter, and summarizes
+ * them.
+ *
+ * The frames are accessed by their members msg_ and stamp_, so that the check is shared by the monitoring frame
+ * messages of LaserScanConverter and the message views of tryDeserializeScanRound().
+ *
+ * @returns ScanConversionStatus::ok if summary was filled, the status of the first violation found otherwise.
+ */
+template <typename Stamped>
+ScanConversionStatus summarizeFrames(const std::vector<Stamped>& stamped_msgs, FramesSummary& summary);
+
+//! @brief Returns the position of the first measurement of a frame within a scan starting at min_angle.
+template <typename Msg>
+int positionInScan(const Msg& msg, const util::TenthOfDegree& min_angle);
+
+/**
+ * @brief Returns true if all filled frames are aligned to the scan starting at min_angle, lie within its
+ * number_of_samples and do not overlap.
+ *
+ * The overlap is checked pairwise, which is cheaper than sorting for the few frames of a scan round. The resolution of
+ * the frames is expected to be checked by summarizeFrames().
+ */
+template <typename Stamped>
+bool framesFitIntoScan(const std::vector<Stamped>& stamped_msgs,
+                       const util::TenthOfDegree& min_angle,
+                       const std::size_t& number_of_samples);
+
 /**
  * @brief: Responsible for converting Monitoring frames into LaserScan messages.
  */
@@ -62,62 +143,275 @@ public:
   static LaserScan
   toLaserScan(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs);
 
+  /**
+   * @brief Variant of toLaserScan() for the per-frame path, reporting protocol violations by the returned status.
+   *
+   * @param scan Is only assigned if ScanConversionStatus::ok is returned.
+   *
+   * @throws data_conversion_layer::monitoring_frame::AdditionalFieldMissing if measurements, scan_counter or
+   * active_zoneset are not set in one of the stamped_msgs.
+   */
+  static ScanConversionStatus
+  tryToLaserScan(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
+                 boost::optional<LaserScan>& scan);
+
+  /**
+   * @brief Converts the frames of an incomplete scan round to a LaserScan, in which the missing measurements are
+   * filled in.
+   *
+   * The frames may leave gaps between each other. The measurements and intensities of the gaps are NaN, or
+   * LaserScan::MISSING_RAW_MEASUREMENT and 0 respectively for raw samples. The scan covers at least the
+   * expected_angles, which are usually taken from the last complete scan, so that frames missing at the beginning or
+   * the end of the round are filled in as well. Without expected_angles the scan covers the range from the first to
+   * the last frame received.
+   *
+   * @param scan Is only assigned if ScanConversionStatus::ok is returned.
+   *
+   * @returns ScanConversionStatus::no_frames if none of the frames contains measurements,
+   * ScanConversionStatus::invalid_resolution if the resolution of the frames is not positive and
+   * ScanConversionStatus::theta_angles_mismatch if the frames overlap or are not aligned to a common grid.
+   *
+   * @throws data_conversion_layer::monitoring_frame::AdditionalFieldMissing if measurements, scan_counter or
+   * active_zoneset are not set in one of the stamped_msgs.
+   *
+   * @see LaserScan::numberOfMissingMeasurements()
+   */
+  static ScanConversionStatus
+  tryToPartialLaserScan(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
+                        const boost::optional<ScanAngles>& expected_angles,
+                        boost::optional<LaserScan>& scan);
+
+  /**
+   * @brief Returns the time at which the first ray of a monitoring frame was measured.
+   *
+   * @param stamp Reception time of the monitoring frame, which corresponds to the time of its last ray.
+   */
+  static int64_t calculateFirstRayTime(const int64_t& stamp,
+                                       const util::TenthOfDegree& resolution,
+                                       const std::size_t& number_of_measurements);
+
 private:
-  static std::vector<int> getFilledFramesIndicesSortedByThetaAngle(
-      const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs);
-  static util::TenthOfDegree
-  calculateMaxAngle(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
-                    const util::TenthOfDegree& min_angle);
-  static int64_t
-  calculateTimestamp(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
-                     const std::vector<int>& filled_stamped_msgs_indices);
   static int64_t calculateFirstRayTime(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg);
-  static void
-  validateMonitoringFrames(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
-                           const std::vector<int>& sorted_stamped_msgs_indices);
-  static bool
-  allResolutionsMatch(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs);
-  static bool
-  allScanCountersMatch(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs);
-  static bool
-  thetaAnglesFitTogether(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
-                         const std::vector<int>& sorted_stamped_msgs_indices);
+  static std::vector<IOState>
+  collectIOStates(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs);
+  /**
+   * @brief Allocates the measurements and intensities of the scan once and copies the samples of each frame to its
+   * angular position.
+   *
+   * The frames are expected to lie within the scan without overlapping, see framesFitIntoScan(), and to contain as many
+   * samples as measurements.
+   *
+   * Samples not covered by a frame are NaN, or LaserScan::MISSING_RAW_MEASUREMENT and 0 respectively for raw
+   * samples.
+   */
+  static void assignSamples(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
+                            const FramesSummary& summary,
+                            const util::TenthOfDegree& min_angle,
+                            const std::size_t& number_of_samples,
+                            LaserScan& scan);
+  template <typename Data, typename GetSamples>
+  static Data placeSamples(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
+                           const util::TenthOfDegree& min_angle,
+                           const std::size_t& number_of_samples,
+                           const typename Data::value_type& fill_value,
+                           const GetSamples& get_samples);
 };
 
+inline std::string toString(const ScanConversionStatus& status)
+{
+  switch (status)
+  {
+    case ScanConversionStatus::ok:
+      return "ok";
+    case ScanConversionStatus::no_frames:
+      return "At least one monitoring frame is necessary to create a LaserScan";
+    case ScanConversionStatus::resolutions_mismatch:
+      return "The resolution of all monitoring frames has to be the same.";
+    case ScanConversionStatus::invalid_resolution:
+      return "The resolution of the monitoring frames has to be positive.";
+    case ScanConversionStatus::scan_counters_mismatch:
+      return "The scan counters of all monitoring frames have to be the same.";
+    case ScanConversionStatus::theta_angles_mismatch:
+      return "The monitoring frame ranges do not cover the whole scan range";
+  }
+  return "unknown status";  // LCOV_EXCL_LINE
+}
+
 inline LaserScan LaserScanConverter::toLaserScan(
     const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs)
 {
-  if (stamped_msgs.empty())
+  boost::optional<LaserScan> scan;
+  const ScanConversionStatus status{ tryToLaserScan(stamped_msgs, scan) };
+  if (status != ScanConversionStatus::ok)
+  {
+    throw ScannerProtocolViolationError(toString(status));
+  }
+  return std::move(scan.get());
+}
+
+inline ScanConversionStatus LaserScanConverter::tryToLaserScan(
+    const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
+    boost::optional<LaserScan>& scan)
+{
+  FramesSummary summary;
+  const ScanConversionStatus status{ summarizeFrames(stamped_msgs, summary) };
+  if (status != ScanConversionStatus::ok)
   {
-    throw ScannerProtocolViolationError("At least one monitoring frame is necessary to create a LaserScan");
+    return status;
   }
 
-  std::vector<int> sorted_stamped_msgs_indices = getFilledFramesIndicesSortedByThetaAngle(stamped_msgs);
-  validateMonitoringFrames(stamped_msgs, sorted_stamped_msgs_indices);
+  const auto& first_msg = stamped_msgs[summary.first_frame_index].msg_;
+  const auto resolution = first_msg.resolution();
+  const auto min_angle = first_msg.fromTheta();
+  const auto max_angle = min_angle + resolution * static_cast<int>(summary.number_of_samples - 1);
+  // Frames which do not overlap and fit into a scan of the summed up size cover it without gaps.
+  if (!framesFitIntoScan(stamped_msgs, min_angle, summary.number_of_samples))
+  {
+    return ScanConversionStatus::theta_angles_mismatch;
+  }
 
-  const auto min_angle = stamped_msgs[sorted_stamped_msgs_indices[0]].msg_.fromTheta();
-  const auto max_angle = calculateMaxAngle(stamped_msgs, min_angle);
+  scan.emplace(resolution,
+               min_angle,
+               max_angle,
+               stamped_msgs[0].msg_.scanCounter(),
+               stamped_msgs[summary.last_frame_index].msg_.activeZoneset(),
+               calculateFirstRayTime(stamped_msgs[summary.earliest_frame_index]),
+               first_msg.scannerId());
+  assignSamples(stamped_msgs, summary, min_angle, summary.number_of_samples, scan.get());
+  scan->ioStates(collectIOStates(stamped_msgs));
 
-  const auto timestamp = calculateTimestamp(stamped_msgs, sorted_stamped_msgs_indices);
-  configuration::ScannerId scanner_id = stamped_msgs[sorted_stamped_msgs_indices[0]].msg_.scannerId();
+  return ScanConversionStatus::ok;
+}
 
-  std::vector<double> measurements;
-  std::vector<double> intensities;
-  std::vector<IOState> io_states;
+inline ScanConversionStatus LaserScanConverter::tryToPartialLaserScan(
+    const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
+    const boost::optional<ScanAngles>& expected_angles,
+    boost::optional<LaserScan>& scan)
+{
+  FramesSummary summary;
+  const ScanConversionStatus status{ summarizeFrames(stamped_msgs, summary) };
+  if (status != ScanConversionStatus::ok)
+  {
+    return status;
+  }
+
+  const auto& first_msg = stamped_msgs[summary.first_frame_index].msg_;
+  const auto& last_msg = stamped_msgs[summary.last_frame_index].msg_;
+  const auto resolution = first_msg.resolution();
+  const auto first_angle = first_msg.fromTheta();
+  const auto last_angle = last_msg.fromTheta() + resolution * static_cast<int>(last_msg.numberOfMeasurements() - 1);
+  const auto min_angle = expected_angles ? std::min(first_angle, expected_angles->min_angle) : first_angle;
+  const auto max_angle = expected_angles ? std::max(last_angle, expected_angles->max_angle) : last_angle;
+  // The resolution was checked to be positive by summarizeFrames().
+  if ((max_angle - min_angle).value() % resolution.value() != 0)
+  {
+    return ScanConversionStatus::theta_angles_mismatch;
+  }
+  const std::size_t number_of_samples = ((max_angle - min_angle) / resolution).value() + 1;
+  if (!framesFitIntoScan(stamped_msgs, min_angle, number_of_samples))
+  {
+    return ScanConversionStatus::theta_angles_mismatch;
+  }
+
+  // The first ray of the scan would have been measured before the first ray received.
+  const std::size_t leading_missing_samples = positionInScan(first_msg, min_angle);
+  const auto timestamp = calculateFirstRayTime(
+      calculateFirstRayTime(stamped_msgs[summary.earliest_frame_index]), resolution, leading_missing_samples + 1);
 
-  for (auto index : sorted_stamped_msgs_indices)
+  scan.emplace(resolution,
+               min_angle,
+               max_angle,
+               stamped_msgs[0].msg_.scanCounter(),
+               last_msg.activeZoneset(),
+               timestamp,
+               first_msg.scannerId());
+  assignSamples(stamped_msgs, summary, min_angle, number_of_samples, scan.get());
+  scan->ioStates(collectIOStates(stamped_msgs));
+  scan->numberOfMissingMeasurements(number_of_samples - summary.number_of_samples);
+
+  return ScanConversionStatus::ok;
+}
+
+template <typename Stamped>
+inline ScanConversionStatus summarizeFrames(const std::vector<Stamped>& stamped_msgs, FramesSummary& summary)
+{
+  if (stamped_msgs.empty())
   {
-    measurements.insert(measurements.end(),
-                        stamped_msgs[index].msg_.measurements().begin(),
-                        stamped_msgs[index].msg_.measurements().end());
-    if (stamped_msgs[index].msg_.hasIntensitiesField())
+    return ScanConversionStatus::no_frames;
+  }
+  const auto resolution = stamped_msgs[0].msg_.resolution();
+  // The resolution is taken from the frames unchecked, but the placement of the frames divides by it.
+  if (resolution.value() <= 0)
+  {
+    return ScanConversionStatus::invalid_resolution;
+  }
+  const auto scan_counter = stamped_msgs[0].msg_.scanCounter();
+  for (std::size_t i = 0; i < stamped_msgs.size(); ++i)
+  {
+    const auto& stamped_msg = stamped_msgs[i];
+    if (stamped_msg.msg_.resolution() != resolution)
+    {
+      return ScanConversionStatus::resolutions_mismatch;
+    }
+    if (stamped_msg.msg_.scanCounter() != scan_counter)
+    {
+      return ScanConversionStatus::scan_counters_mismatch;
+    }
+    const std::size_t number_of_measurements{ stamped_msg.msg_.numberOfMeasurements() };
+    if (number_of_measurements == 0)
     {
-      intensities.insert(intensities.end(),
-                         stamped_msgs[index].msg_.intensities().begin(),
-                         stamped_msgs[index].msg_.intensities().end());
+      continue;
     }
+    if (summary.number_of_filled_frames == 0)
+    {
+      summary.first_frame_index = summary.last_frame_index = summary.earliest_frame_index = i;
+    }
+    // Frames with equal angles keep the first one, like a stable sort by angle would.
+    if (stamped_msg.msg_.fromTheta() < stamped_msgs[summary.first_frame_index].msg_.fromTheta())
+    {
+      summary.first_frame_index = i;
+    }
+    if (stamped_msg.msg_.fromTheta() >= stamped_msgs[summary.last_frame_index].msg_.fromTheta())
+    {
+      summary.last_frame_index = i;
+    }
+    if (stamped_msg.stamp_ < stamped_msgs[summary.earliest_frame_index].stamp_)
+    {
+      summary.earliest_frame_index = i;
+    }
+    ++summary.number_of_filled_frames;
+    summary.number_of_samples += number_of_measurements;
+    summary.all_frames_with_intensities &=
+        stamped_msg.msg_.hasIntensitiesField() && stamped_msg.msg_.numberOfIntensities() == number_of_measurements;
+  }
+  if (summary.number_of_filled_frames == 0)
+  {
+    return ScanConversionStatus::no_frames;
   }
+  return ScanConversionStatus::ok;
+}
+
+inline int64_t
+LaserScanConverter::calculateFirstRayTime(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg)
+{
+  return calculateFirstRayTime(
+      stamped_msg.stamp_, stamped_msg.msg_.resolution(), stamped_msg.msg_.numberOfMeasurements());
+}
+
+inline int64_t LaserScanConverter::calculateFirstRayTime(const int64_t& stamp,
+                                                         const util::TenthOfDegree& resolution,
+                                                         const std::size_t& number_of_measurements)
+{
+  const double time_per_scan_in_ns{ configuration::TIME_PER_SCAN_IN_S * 1000000000.0 };
+  const double scan_interval_in_degree{ resolution.value() * (static_cast<double>(number_of_measurements) - 1) /
+                                        10.0 };
+  return stamp - static_cast<int64_t>(std::round(scan_interval_in_degree * time_per_scan_in_ns / 360.0));
+}
 
+inline std::vector<IOState> LaserScanConverter::collectIOStates(
+    const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs)
+{
+  std::vector<IOState> io_states;
   // Issue #320: Only for the io_states, we follow reception order instead Theta order.
   // Other wise: index=0 who is the bigger Theta and correspond to the first io_state of the
   // frame is placed at last item of vector io_states, and it provokes that io_states flicks.
@@ -134,129 +428,146 @@ inline LaserScan LaserScanConverter::toLaserScan(
       io_states.emplace_back(single_msg.msg_.iOPinData(), single_msg.stamp_);
     }
   }
-
-  LaserScan scan(stamped_msgs[0].msg_.resolution(),
-                 min_angle,
-                 max_angle,
-                 stamped_msgs[0].msg_.scanCounter(),
-                 stamped_msgs[sorted_stamped_msgs_indices.back()].msg_.activeZoneset(),
-                 timestamp,
-                 scanner_id);
-
-  scan.measurements(measurements);
-  scan.intensities(intensities);
-  scan.ioStates(io_states);
-
-  return scan;
+  return io_states;
 }
 
-inline std::vector<int> LaserScanConverter::getFilledFramesIndicesSortedByThetaAngle(
-    const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs)
+template <typename Msg>
+inline int positionInScan(const Msg& msg, const util::TenthOfDegree& min_angle)
 {
-  std::vector<int> sorted_filled_stamped_msgs_indices(stamped_msgs.size());
-  std::iota(sorted_filled_stamped_msgs_indices.begin(), sorted_filled_stamped_msgs_indices.end(), 0);
-  std::sort(sorted_filled_stamped_msgs_indices.begin(),
-            sorted_filled_stamped_msgs_indices.end(),
-            [&stamped_msgs](int i1, int i2) {
-              return stamped_msgs[i1].msg_.fromTheta() < stamped_msgs[i2].msg_.fromTheta();
-            });
-
-  // The following contains a missing line in the coverage report, which does not make sense.
-  // LCOV_EXCL_START
-  sorted_filled_stamped_msgs_indices.erase(
-      std::remove_if(sorted_filled_stamped_msgs_indices.begin(),
-                     sorted_filled_stamped_msgs_indices.end(),
-                     [&stamped_msgs](int i) { return stamped_msgs[i].msg_.measurements().empty(); }),
-      sorted_filled_stamped_msgs_indices.end());
-  // LCOV_EXCL_STOP
-
-  return sorted_filled_stamped_msgs_indices;
+  return ((msg.fromTheta() - min_angle) / msg.resolution()).value();
 }
 
-inline util::TenthOfDegree LaserScanConverter::calculateMaxAngle(
-    const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
-    const util::TenthOfDegree& min_angle)
+template <typename Stamped>
+inline bool framesFitIntoScan(const std::vector<Stamped>& stamped_msgs,
+                              const util::TenthOfDegree& min_angle,
+                              const std::size_t& number_of_samples)
 {
-  const auto resolution = stamped_msgs[0].msg_.resolution();
-  const uint16_t number_of_samples = std::accumulate(
-      stamped_msgs.begin(), stamped_msgs.end(), uint16_t{ 0 }, [](uint16_t total, const auto& stamped_msg) {
-        return total + stamped_msg.msg_.measurements().size();
-      });
-  return min_angle + resolution * static_cast<int>(number_of_samples - 1);
-}
-
-inline int64_t LaserScanConverter::calculateTimestamp(
-    const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
-    const std::vector<int>& filled_stamped_msgs_indices)
-{
-  const auto it = std::min_element(
-      filled_stamped_msgs_indices.begin(), filled_stamped_msgs_indices.end(), [&stamped_msgs](int i, int j) {
-        return stamped_msgs[i].stamp_ < stamped_msgs[j].stamp_;
-      });  // determines stamped_msg with smallest stamp
-  return calculateFirstRayTime(stamped_msgs[*it]);
-}
-
-inline int64_t
-LaserScanConverter::calculateFirstRayTime(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg)
-{
-  const double time_per_scan_in_ns{ configuration::TIME_PER_SCAN_IN_S * 1000000000.0 };
-  const double scan_interval_in_degree{ stamped_msg.msg_.resolution().value() *
-                                        (stamped_msg.msg_.measurements().size() - 1) / 10.0 };
-  return stamped_msg.stamp_ - static_cast<int64_t>(std::round(scan_interval_in_degree * time_per_scan_in_ns / 360.0));
+  for (std::size_t i = 0; i < stamped_msgs.size(); ++i)
+  {
+    const auto& msg = stamped_msgs[i].msg_;
+    const int number_of_measurements{ static_cast<int>(msg.numberOfMeasurements()) };
+    if (number_of_measurements == 0)
+    {
+      continue;
+    }
+    const int position{ positionInScan(msg, min_angle) };
+    if ((msg.fromTheta() - min_angle).value() % msg.resolution().value() != 0 || position < 0 ||
+        position + number_of_measurements > static_cast<int>(number_of_samples))
+    {
+      return false;
+    }
+    for (std::size_t j = 0; j < i; ++j)
+    {
+      const auto& other_msg = stamped_msgs[j].msg_;
+      const int other_position{ positionInScan(other_msg, min_angle) };
+      const int other_number_of_measurements{ static_cast<int>(other_msg.numberOfMeasurements()) };
+      if (other_number_of_measurements != 0 && position < other_position + other_number_of_measurements &&
+          other_position < position + number_of_measurements)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
 }
 
-inline void LaserScanConverter::validateMonitoringFrames(
+inline void LaserScanConverter::assignSamples(
     const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
-    const std::vector<int>& sorted_stamped_msgs_indices)
+    const FramesSummary& summary,
+    const util::TenthOfDegree& min_angle,
+    const std::size_t& number_of_samples,
+    LaserScan& scan)
 {
-  if (!allResolutionsMatch(stamped_msgs))
+  using data_conversion_layer::monitoring_frame::Message;
+  const Message& first_msg{ stamped_msgs[summary.first_frame_index].msg_ };
+  if (first_msg.hasRawSamples())
   {
-    throw ScannerProtocolViolationError("The resolution of all monitoring frames has to be the same.");
+    scan.rawMeasurements(placeSamples<LaserScan::RawMeasurementData>(
+        stamped_msgs,
+        min_angle,
+        number_of_samples,
+        LaserScan::MISSING_RAW_MEASUREMENT,
+        [](const Message& msg) -> const LaserScan::RawMeasurementData& { return msg.rawMeasurements(); }));
+    if (summary.all_frames_with_intensities)
+    {
+      scan.rawIntensities(placeSamples<LaserScan::RawIntensityData>(
+          stamped_msgs, min_angle, number_of_samples, 0, [](const Message& msg) -> const LaserScan::RawIntensityData& {
+            return msg.rawIntensities();
+          }));
+    }
   }
-  else if (!allScanCountersMatch(stamped_msgs))
+  else if (first_msg.isSinglePrecision())
   {
-    throw ScannerProtocolViolationError("The scan counters of all monitoring frames have to be the same.");
+    const float nan{ std::numeric_limits<float>::quiet_NaN() };
+    scan.singlePrecisionMeasurements(placeSamples<LaserScan::SinglePrecisionMeasurementData>(
+        stamped_msgs,
+        min_angle,
+        number_of_samples,
+        nan,
+        [](const Message& msg) -> const LaserScan::SinglePrecisionMeasurementData& {
+          return msg.singlePrecisionMeasurements();
+        }));
+    if (summary.all_frames_with_intensities)
+    {
+      scan.singlePrecisionIntensities(placeSamples<LaserScan::SinglePrecisionIntensityData>(
+          stamped_msgs,
+          min_angle,
+          number_of_samples,
+          nan,
+          [](const Message& msg) -> const LaserScan::SinglePrecisionIntensityData& {
+            return msg.singlePrecisionIntensities();
+          }));
+    }
   }
-  else if (!thetaAnglesFitTogether(stamped_msgs, sorted_stamped_msgs_indices))
+  else
   {
-    throw ScannerProtocolViolationError("The monitoring frame ranges do not cover the whole scan range");
+    const double nan{ std::numeric_limits<double>::quiet_NaN() };
+    scan.measurements(placeSamples<LaserScan::MeasurementData>(
+        stamped_msgs, min_angle, number_of_samples, nan, [](const Message& msg) -> const LaserScan::MeasurementData& {
+          return msg.measurements();
+        }));
+    if (summary.all_frames_with_intensities)
+    {
+      scan.intensities(placeSamples<LaserScan::IntensityData>(
+          stamped_msgs, min_angle, number_of_samples, nan, [](const Message& msg) -> const LaserScan::IntensityData& {
+            return msg.intensities();
+          }));
+    }
   }
 }
 
-inline bool LaserScanConverter::allResolutionsMatch(
-    const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs)
-{
-  const auto resolution = stamped_msgs[0].msg_.resolution();
-  return std::all_of(stamped_msgs.begin(), stamped_msgs.end(), [resolution](const auto& stamped_msg) {
-    return stamped_msg.msg_.resolution() == resolution;
-  });
-}
-
-inline bool LaserScanConverter::allScanCountersMatch(
-    const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs)
-{
-  const auto scan_counter = stamped_msgs[0].msg_.scanCounter();
-  return std::all_of(stamped_msgs.begin(), stamped_msgs.end(), [scan_counter](const auto& stamped_msg) {
-    return stamped_msg.msg_.scanCounter() == scan_counter;
-  });
-}
-
-inline bool LaserScanConverter::thetaAnglesFitTogether(
+template <typename Data, typename GetSamples>
+inline Data LaserScanConverter::placeSamples(
     const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
-    const std::vector<int>& sorted_filled_stamped_msgs_indices)
+    const util::TenthOfDegree& min_angle,
+    const std::size_t& number_of_samples,
+    const typename Data::value_type& fill_value,
+    const GetSamples& get_samples)
 {
-  util::TenthOfDegree last_end = stamped_msgs[sorted_filled_stamped_msgs_indices[0]].msg_.fromTheta();
-  for (auto index : sorted_filled_stamped_msgs_indices)
+  Data data;
+  data.reserve(number_of_samples);
+  for (const auto& stamped_msg : stamped_msgs)
   {
-    const auto& stamped_msg = stamped_msgs[index];
-    if (last_end != stamped_msg.msg_.fromTheta())
+    const auto& msg = stamped_msg.msg_;
+    const std::size_t number_of_measurements{ msg.numberOfMeasurements() };
+    if (number_of_measurements == 0)
     {
-      return false;
+      continue;
+    }
+    const auto& samples = get_samples(msg);
+    const std::size_t position = positionInScan(msg, min_angle);
+    // Frames arriving in angular order are appended. Only the samples in front of a frame, which are not covered
+    // (yet), are filled in.
+    if (data.size() < position)
+    {
+      data.resize(position, fill_value);
     }
-    last_end = stamped_msg.msg_.fromTheta() +
-               stamped_msg.msg_.resolution() * static_cast<int>(stamped_msg.msg_.measurements().size());
+    const std::size_t number_of_placed_samples{ std::min(number_of_measurements, data.size() - position) };
+    std::copy_n(samples.begin(), number_of_placed_samples, data.begin() + position);
+    data.insert(data.end(), samples.begin() + number_of_placed_samples, samples.begin() + number_of_measurements);
   }
-  return true;
+  data.resize(number_of_samples, fill_value);
+  return data;
 }
 
 }  // namespace data_conversion_layer
@@ -0,0 +1,162 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_DECODE_OPTIONS_H
+#define PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_DECODE_OPTIONS_H
+
+#include <cstdint>
+
+namespace psen_scan_v2_standalone
+{
+namespace data_conversion_layer
+{
+namespace monitoring_frame
+{
+/**
+ * @brief Additional fields of a monitoring frame which can be selected for decoding.
+ *
+ * @see DecodeOptions
+ */
+enum class DecodeField : uint8_t
+{
+  scan_counter = 1 << 0,
+  zoneset = 1 << 1,
+  measurements = 1 << 2,
+  intensities = 1 << 3,
+  io_pin_data = 1 << 4,
+  diagnostics = 1 << 5
+};
+
+/**
+ * @brief Bitmask defining which additional fields of a monitoring frame are decoded.
+ *
+ * Fields which are not selected are skipped by their offset during deserialization and appear as missing in the
+ * resulting Message. By default all fields are decoded.
+ *
+ * Additionally the options define whether measurements and intensities are decoded in single precision, or are not
+ * converted at all and kept as the raw samples sent by the scanner. Raw samples take precedence over single precision.
+ *
+ * @see deserialize()
+ */
+class DecodeOptions
+{
+public:
+  //! @brief Creates options decoding all fields.
+  constexpr DecodeOptions() = default;
+
+  //! @brief Creates options decoding none of the additional fields.
+  static constexpr DecodeOptions none();
+
+  //! @brief Returns a copy of the options with the given field selected for decoding.
+  constexpr DecodeOptions with(const DecodeField& field) const;
+  //! @brief Returns a copy of the options with the given field deselected.
+  constexpr DecodeOptions without(const DecodeField& field) const;
+  //! @brief Returns a copy of the options with all fields of the given options selected in addition.
+  constexpr DecodeOptions with(const DecodeOptions& options) const;
+
+  //! @brief Returns a copy of the options decoding measurements and intensities into float instead of double.
+  constexpr DecodeOptions withSinglePrecision(const bool& enable = true) const;
+  //! @brief Returns a copy of the options keeping measurements and intensities as raw uint16 samples.
+  constexpr DecodeOptions withRawSamples(const bool& enable = true) const;
+
+  constexpr bool decodes(const DecodeField& field) const;
+  constexpr bool singlePrecision() const;
+  constexpr bool rawSamples() const;
+  constexpr uint8_t mask() const;
+
+  constexpr bool operator==(const DecodeOptions& rhs) const;
+  constexpr bool operator!=(const DecodeOptions& rhs) const;
+
+private:
+  constexpr explicit DecodeOptions(const uint8_t& mask);
+
+private:
+  static constexpr uint8_t ALL_FIELDS{ 0b00111111 };
+  static constexpr uint8_t SINGLE_PRECISION{ 0b01000000 };
+  static constexpr uint8_t RAW_SAMPLES{ 0b10000000 };
+
+private:
+  uint8_t mask_{ ALL_FIELDS };
+};
+
+inline constexpr DecodeOptions::DecodeOptions(const uint8_t& mask) : mask_(mask)
+{
+}
+
+inline constexpr DecodeOptions DecodeOptions::none()
+{
+  return DecodeOptions(0);
+}
+
+inline constexpr DecodeOptions DecodeOptions::with(const DecodeField& field) const
+{
+  return DecodeOptions(mask_ | static_cast<uint8_t>(field));
+}
+
+inline constexpr DecodeOptions DecodeOptions::without(const DecodeField& field) const
+{
+  return DecodeOptions(mask_ & static_cast<uint8_t>(~static_cast<uint8_t>(field)));
+}
+
+inline constexpr DecodeOptions DecodeOptions::with(const DecodeOptions& options) const
+{
+  return DecodeOptions(mask_ | options.mask_);
+}
+
+inline constexpr DecodeOptions DecodeOptions::withSinglePrecision(const bool& enable) const
+{
+  return DecodeOptions(enable ? (mask_ | SINGLE_PRECISION) : (mask_ & static_cast<uint8_t>(~SINGLE_PRECISION)));
+}
+
+inline constexpr DecodeOptions DecodeOptions::withRawSamples(const bool& enable) const
+{
+  return DecodeOptions(enable ? (mask_ | RAW_SAMPLES) : (mask_ & static_cast<uint8_t>(~RAW_SAMPLES)));
+}
+
+inline constexpr bool DecodeOptions::decodes(const DecodeField& field) const
+{
+  return (mask_ & static_cast<uint8_t>(field)) != 0;
+}
+
+inline constexpr bool DecodeOptions::singlePrecision() const
+{
+  return (mask_ & SINGLE_PRECISION) != 0;
+}
+
+inline constexpr bool DecodeOptions::rawSamples() const
+{
+  return (mask_ & RAW_SAMPLES) != 0;
+}
+
+inline constexpr uint8_t DecodeOptions::mask() const
+{
+  return mask_;
+}
+
+inline constexpr bool DecodeOptions::operator==(const DecodeOptions& rhs) const
+{
+  return mask_ == rhs.mask_;
+}
+
+inline constexpr bool DecodeOptions::operator!=(const DecodeOptions& rhs) const
+{
+  return mask_ != rhs.mask_;
+}
+
+}  // namespace monitoring_frame
+}  // namespace data_conversion_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_DECODE_OPTIONS_H
@@ -25,6 +25,7 @@
 #include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/diagnostics.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_decode_options.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/raw_processing.h"
 #include "psen_scan_v2_standalone/util/tenth_of_degree.h"
@@ -144,18 +145,72 @@ enum class AdditionalFieldHeaderID : AdditionalFieldHeader::Id
 };
 
 AdditionalFieldHeader readAdditionalField(std::istream& is, const std::size_t& max_num_bytes);
+AdditionalFieldHeader readAdditionalField(raw_processing::RawDataReader& reader, const std::size_t& max_num_bytes);
 
-monitoring_frame::Message deserialize(const data_conversion_layer::RawData& data, const std::size_t& num_bytes);
+/**
+ * @brief Returns the largest size a monitoring frame can have when sent with the given scan settings.
+ *
+ * The size is calculated for a frame containing all additional fields and the measurements of a complete scan, so it
+ * also holds if the scanner does not split the scan into several frames. Buffers of this size are sufficient to
+ * receive any monitoring frame, while being an order of magnitude smaller than MAX_UDP_PAKET_SIZE.
+ */
+std::size_t maxFrameSize(const util::TenthOfDegree& resolution, const bool& intensities_enabled);
+
+/**
+ * @brief Deserializes the first num_bytes of data into a monitoring_frame::Message.
+ *
+ * The fields are decoded directly from the given buffer without copying it. Additional fields not selected in options
+ * are skipped by their length and are missing in the returned Message.
+ *
+ * @throws DecodingFailure if the frame is malformed.
+ * @throws AdditionalFieldUnexpectedSize if a field with fixed size has an unexpected length.
+ */
+monitoring_frame::Message deserialize(const data_conversion_layer::RawData& data,
+                                      const std::size_t& num_bytes,
+                                      const DecodeOptions& options = DecodeOptions());
+
+/**
+ * @brief Outcome of tryDeserialize().
+ */
+enum class DecodingStatus
+{
+  ok,
+  //! The frame ends before a field or the end_of_frame field is complete.
+  truncated_frame,
+  //! The length given in the header of an additional field exceeds the frame.
+  field_length_too_large,
+  //! A field with fixed size has an unexpected length.
+  unexpected_field_size,
+  //! The id of an additional field is unknown.
+  unknown_field_id
+};
+
+std::string toString(const DecodingStatus& status);
+
+/**
+ * @brief Variant of deserialize() for the per-frame path, reporting malformed frames by the returned status.
+ *
+ * Malformed frames are expected on lossy networks, so no exception is thrown for them. Only failures which are not
+ * caused by the content of the frame, like std::bad_alloc, are still thrown.
+ *
+ * @param msg Is only assigned if DecodingStatus::ok is returned.
+ */
+DecodingStatus tryDeserialize(const data_conversion_layer::RawData& data,
+                              const std::size_t& num_bytes,
+                              const DecodeOptions& options,
+                              Message& msg);
 FixedFields readFixedFields(std::istream& is);
+FixedFields readFixedFields(raw_processing::RawDataReader& reader);
 namespace diagnostic
 {
 std::vector<diagnostic::Message> deserializeMessages(std::istream& is);
-}
+std::vector<diagnostic::Message> deserializeMessages(raw_processing::RawDataReader& reader);
+}  // namespace diagnostic
 
 namespace io
 {
-template <size_t ChunkSize>
-void deserializePinField(std::istream& is, std::array<std::bitset<8>, ChunkSize>& pin_states)
+template <size_t ChunkSize, typename Source>
+void deserializePinField(Source& is, std::array<std::bitset<8>, ChunkSize>& pin_states)
 {
   for (auto& byte_states : pin_states)
   {
@@ -164,6 +219,7 @@ void deserializePinField(std::istream& is, std::array<std::bitset<8>, ChunkSize>
   }
 }
 PinData deserializePins(std::istream& is);
+PinData deserializePins(raw_processing::RawDataReader& reader);
 }  // namespace io
 
 /**
@@ -0,0 +1,199 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_FIELD_DESCRIPTORS_H
+#define PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_FIELD_DESCRIPTORS_H
+
+#include <cstddef>
+#include <limits>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/diagnostics.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_decode_options.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg_builder.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_processing.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace data_conversion_layer
+{
+namespace monitoring_frame
+{
+//! @brief Constraint on the payload length of an additional field.
+struct FieldSize
+{
+  enum class Kind
+  {
+    any,
+    exactly,
+    at_least
+  };
+
+  Kind kind;
+  std::size_t bytes;
+};
+
+static constexpr FieldSize anySize()
+{
+  return FieldSize{ FieldSize::Kind::any, 0 };
+}
+
+static constexpr FieldSize exactSize(const std::size_t& bytes)
+{
+  return FieldSize{ FieldSize::Kind::exactly, bytes };
+}
+
+static constexpr FieldSize minimumSize(const std::size_t& bytes)
+{
+  return FieldSize{ FieldSize::Kind::at_least, bytes };
+}
+
+//! @brief Returns true if a payload of the given length satisfies the constraint.
+static constexpr bool fitsFieldSize(const FieldSize& size, const std::size_t& length)
+{
+  return !((size.kind == FieldSize::Kind::exactly && length != size.bytes) ||
+           (size.kind == FieldSize::Kind::at_least && length < size.bytes));
+}
+
+/**
+ * @brief Decodes the payload of an additional field into the message.
+ *
+ * The payload is already checked against the FieldSize of the field, so a decoder cannot read out of bounds.
+ */
+using FieldDecoder = void (*)(raw_processing::RawDataReader& payload,
+                              const DecodeOptions& options,
+                              MessageBuilder& msg_builder);
+
+//! @brief Decoders of the additional fields, which are defined along with deserialize().
+namespace field_decoder
+{
+void decodeIOPinData(raw_processing::RawDataReader& payload, const DecodeOptions& options, MessageBuilder& msg_builder);
+void decodeScanCounter(raw_processing::RawDataReader& payload,
+                       const DecodeOptions& options,
+                       MessageBuilder& msg_builder);
+void decodeZoneset(raw_processing::RawDataReader& payload, const DecodeOptions& options, MessageBuilder& msg_builder);
+void decodeDiagnostics(raw_processing::RawDataReader& payload,
+                       const DecodeOptions& options,
+                       MessageBuilder& msg_builder);
+void decodeMeasurements(raw_processing::RawDataReader& payload,
+                        const DecodeOptions& options,
+                        MessageBuilder& msg_builder);
+void decodeIntensities(raw_processing::RawDataReader& payload,
+                       const DecodeOptions& options,
+                       MessageBuilder& msg_builder);
+}  // namespace field_decoder
+
+//! @brief Compile time description of an additional field.
+struct FieldDescriptor
+{
+  AdditionalFieldHeaderID id;
+  const char* name;
+  DecodeField selection;
+  FieldSize size;
+  FieldDecoder decode;
+};
+
+/**
+ * @brief All additional fields known to the deserialization, except for the end_of_frame marker.
+ *
+ * Supporting a new field only requires a new entry here, the dispatch table is generated from this list. Both
+ * deserialize() and MessageView check the fields against these descriptors.
+ */
+static constexpr FieldDescriptor FIELD_DESCRIPTORS[]{
+  { AdditionalFieldHeaderID::io_pin_data,
+    "io state",
+    DecodeField::io_pin_data,
+    exactSize(io::RAW_CHUNK_LENGTH_IN_BYTES),
+    &field_decoder::decodeIOPinData },
+  { AdditionalFieldHeaderID::scan_counter,
+    "scan counter",
+    DecodeField::scan_counter,
+    exactSize(NUMBER_OF_BYTES_SCAN_COUNTER),
+    &field_decoder::decodeScanCounter },
+  { AdditionalFieldHeaderID::zone_set,
+    "zone set",
+    DecodeField::zoneset,
+    exactSize(NUMBER_OF_BYTES_ZONE_SET),
+    &field_decoder::decodeZoneset },
+  { AdditionalFieldHeaderID::diagnostics,
+    "diagnostics",
+    DecodeField::diagnostics,
+    minimumSize(diagnostic::RAW_CHUNK_LENGTH_IN_BYTES),
+    &field_decoder::decodeDiagnostics },
+  { AdditionalFieldHeaderID::measurements,
+    "measurements",
+    DecodeField::measurements,
+    anySize(),
+    &field_decoder::decodeMeasurements },
+  { AdditionalFieldHeaderID::intensities,
+    "intensities",
+    DecodeField::intensities,
+    anySize(),
+    &field_decoder::decodeIntensities }
+};
+
+static constexpr std::size_t NUMBER_OF_FIELD_IDS{ std::numeric_limits<AdditionalFieldHeader::Id>::max() + 1 };
+
+//! @brief Maps every possible field id to its descriptor, ids of unknown fields map to nullptr.
+struct FieldDispatchTable
+{
+  const FieldDescriptor* descriptors[NUMBER_OF_FIELD_IDS];
+};
+
+static constexpr FieldDispatchTable createFieldDispatchTable()
+{
+  FieldDispatchTable table{};
+  for (const FieldDescriptor& descriptor : FIELD_DESCRIPTORS)
+  {
+    table.descriptors[static_cast<AdditionalFieldHeader::Id>(descriptor.id)] = &descriptor;
+  }
+  return table;
+}
+
+static constexpr bool fieldDescriptorsAreValid()
+{
+  for (std::size_t i = 0; i < sizeof(FIELD_DESCRIPTORS) / sizeof(FieldDescriptor); ++i)
+  {
+    if (FIELD_DESCRIPTORS[i].id == AdditionalFieldHeaderID::end_of_frame)
+    {
+      return false;
+    }
+    for (std::size_t j = i + 1; j < sizeof(FIELD_DESCRIPTORS) / sizeof(FieldDescriptor); ++j)
+    {
+      if (FIELD_DESCRIPTORS[i].id == FIELD_DESCRIPTORS[j].id)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static_assert(fieldDescriptorsAreValid(), "Every additional field, except for end_of_frame, needs one descriptor.");
+
+static constexpr FieldDispatchTable FIELD_DISPATCH_TABLE{ createFieldDispatchTable() };
+
+//! @brief Returns the descriptor of the field with the given id, or nullptr if the id is unknown.
+static constexpr const FieldDescriptor* fieldDescriptor(const AdditionalFieldHeader::Id& id)
+{
+  return FIELD_DISPATCH_TABLE.descriptors[id];
+}
+
+}  // namespace monitoring_frame
+}  // namespace data_conversion_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_FIELD_DESCRIPTORS_H
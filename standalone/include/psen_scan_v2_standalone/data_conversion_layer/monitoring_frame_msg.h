@@ -16,9 +16,11 @@
 #ifndef PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_MSG_H
 #define PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_MSG_H
 
+#include <cstddef>
 #include <cstdint>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <boost/optional.hpp>
@@ -71,10 +73,42 @@ public:
   uint8_t activeZoneset() const;
   //! @throw AdditionalFieldMissing if io_pin_data was missing during deserialization of a Message.
   const io::PinData& iOPinData() const;
-  //! @throw AdditionalFieldMissing if measurements were missing during deserialization of a Message.
+  //! @throw AdditionalFieldMissing if measurements were missing or decoded in single precision.
   const std::vector<double>& measurements() const;
-  //! @throw AdditionalFieldMissing if intensities were missing during deserialization of a Message.
+  //! @throw AdditionalFieldMissing if intensities were missing or decoded in single precision.
   const std::vector<double>& intensities() const;
+  //! @throw AdditionalFieldMissing if measurements were missing or not decoded in single precision.
+  const std::vector<float>& singlePrecisionMeasurements() const;
+  //! @throw AdditionalFieldMissing if intensities were missing or not decoded in single precision.
+  const std::vector<float>& singlePrecisionIntensities() const;
+  /**
+   * @brief Returns the raw distance samples in mm as sent by the scanner.
+   *
+   * The special values NO_SIGNAL_ARRIVED and SIGNAL_TOO_LATE are not mapped.
+   *
+   * @throw AdditionalFieldMissing if measurements were missing or not decoded as raw samples.
+   */
+  const std::vector<uint16_t>& rawMeasurements() const;
+  /**
+   * @brief Returns the raw intensity samples as sent by the scanner, including the two flag bits.
+   *
+   * @throw AdditionalFieldMissing if intensities were missing or not decoded as raw samples.
+   */
+  const std::vector<uint16_t>& rawIntensities() const;
+  //! @brief Returns the number of measurements, independent of the format they were decoded in.
+  //! @throw AdditionalFieldMissing if measurements were missing during deserialization of a Message.
+  std::size_t numberOfMeasurements() const;
+  //! @brief Returns the number of intensities, independent of the format they were decoded in.
+  //! @throw AdditionalFieldMissing if intensities were missing during deserialization of a Message.
+  std::size_t numberOfIntensities() const;
+  /**
+   * @brief Returns the two highest bits of each raw intensity sample, which are not part of the intensity value.
+   *
+   * The flags are packed, four samples per byte. Use intensityFlags(const uint8_t*, const std::size_t&) to unpack them.
+   *
+   * @throw AdditionalFieldMissing if intensities were missing or decoded as raw samples, which still contain the flags.
+   */
+  const std::vector<uint8_t>& intensityFlags() const;
   //! @throw AdditionalFieldMissing if diagnostic_messages were missing during deserialization of a Message.
   std::vector<diagnostic::Message> diagnosticMessages() const;
 
@@ -84,6 +118,10 @@ public:
   bool hasMeasurementsField() const;
   bool hasIntensitiesField() const;
   bool hasDiagnosticMessagesField() const;
+  //! @brief Returns true if measurements and intensities are stored as float instead of double.
+  bool isSinglePrecision() const;
+  //! @brief Returns true if measurements and intensities are stored as the raw samples sent by the scanner.
+  bool hasRawSamples() const;
 
 private:
   // fixed fields
@@ -96,6 +134,11 @@ private:
   boost::optional<io::PinData> io_pin_data_;
   boost::optional<std::vector<double>> measurements_;
   boost::optional<std::vector<double>> intensities_;
+  boost::optional<std::vector<float>> single_precision_measurements_;
+  boost::optional<std::vector<float>> single_precision_intensities_;
+  boost::optional<std::vector<uint16_t>> raw_measurements_;
+  boost::optional<std::vector<uint16_t>> raw_intensities_;
+  boost::optional<std::vector<uint8_t>> intensity_flags_;
   boost::optional<std::vector<diagnostic::Message>> diagnostic_messages_;
 
 public:
@@ -109,6 +152,7 @@ public:
 struct MessageStamped
 {
   MessageStamped(const Message& message, const int64_t timestamp) : msg_(message), stamp_(timestamp){};
+  MessageStamped(Message&& message, const int64_t timestamp) : msg_(std::move(message)), stamp_(timestamp){};
   Message msg_;
   int64_t stamp_;
 };
@@ -44,6 +44,13 @@ public:
   MessageBuilder& scanCounter(uint32_t scan_counter);
   MessageBuilder& activeZoneset(uint8_t active_zoneset);
   MessageBuilder& intensities(const std::vector<double>& intensities);
+  MessageBuilder& singlePrecisionMeasurements(const std::vector<float>& measurements);
+  MessageBuilder& singlePrecisionIntensities(const std::vector<float>& intensities);
+  MessageBuilder& rawMeasurements(const std::vector<uint16_t>& measurements);
+  MessageBuilder& rawIntensities(const std::vector<uint16_t>& intensities);
+  //! @brief Sets the packed intensity flags.
+  //! @see Message::intensityFlags()
+  MessageBuilder& intensityFlags(const std::vector<uint8_t>& intensity_flags);
   MessageBuilder& diagnosticMessages(const std::vector<diagnostic::Message>& diagnostic_messages);
   MessageBuilder& iOPinData(const io::PinData& io_pin_data);
 
@@ -103,6 +110,36 @@ inline MessageBuilder& MessageBuilder::intensities(const std::vector<double>& in
   return *this;
 }
 
+inline MessageBuilder& MessageBuilder::singlePrecisionMeasurements(const std::vector<float>& measurements)
+{
+  msg_.single_precision_measurements_ = measurements;
+  return *this;
+}
+
+inline MessageBuilder& MessageBuilder::singlePrecisionIntensities(const std::vector<float>& intensities)
+{
+  msg_.single_precision_intensities_ = intensities;
+  return *this;
+}
+
+inline MessageBuilder& MessageBuilder::rawMeasurements(const std::vector<uint16_t>& measurements)
+{
+  msg_.raw_measurements_ = measurements;
+  return *this;
+}
+
+inline MessageBuilder& MessageBuilder::rawIntensities(const std::vector<uint16_t>& intensities)
+{
+  msg_.raw_intensities_ = intensities;
+  return *this;
+}
+
+inline MessageBuilder& MessageBuilder::intensityFlags(const std::vector<uint8_t>& intensity_flags)
+{
+  msg_.intensity_flags_ = intensity_flags;
+  return *this;
+}
+
 inline MessageBuilder& MessageBuilder::diagnosticMessages(const std::vector<diagnostic::Message>& diagnostic_messages)
 {
   msg_.diagnostic_messages_ = diagnostic_messages;
@@ -0,0 +1,167 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_MSG_VIEW_H
+#define PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_MSG_VIEW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "psen_scan_v2_standalone/configuration/scanner_ids.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/diagnostics.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+#include "psen_scan_v2_standalone/util/tenth_of_degree.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace data_conversion_layer
+{
+namespace monitoring_frame
+{
+/**
+ * @brief Lazily decoded alternative to Message.
+ *
+ * On construction only the fixed fields and the headers of the additional fields are read. The small scan counter and
+ * zoneset fields are decoded right away, the offsets of all other additional fields are recorded. Those fields are
+ * decoded the first time their accessor is called and cached afterwards. This way a consumer which, for example, only
+ * needs the active zoneset does not pay for decoding measurements, intensities, IO pins and diagnostics.
+ *
+ * The view shares ownership of the raw data, which must not be modified while the view is in use.
+ *
+ * @note The lazy decoding modifies the internal cache, so a view must not be accessed from several threads without
+ * external synchronization.
+ *
+ * @see Message
+ * @see deserialize()
+ */
+class MessageView
+{
+public:
+  /**
+   * @brief Scans the first num_bytes of data for the fields of a monitoring frame.
+   *
+   * @throws DecodingFailure if the frame is malformed.
+   * @throws AdditionalFieldUnexpectedSize if a field with fixed size has an unexpected length.
+   */
+  MessageView(const RawDataConstPtr& data, const std::size_t& num_bytes);
+
+public:
+  configuration::ScannerId scannerId() const;
+  util::TenthOfDegree fromTheta() const;
+  util::TenthOfDegree resolution() const;
+  //! @throw AdditionalFieldMissing if the frame contains no scan_counter.
+  uint32_t scanCounter() const;
+  //! @throw AdditionalFieldMissing if the frame contains no active_zoneset.
+  uint8_t activeZoneset() const;
+  //! @throw AdditionalFieldMissing if the frame contains no io_pin_data.
+  const io::PinData& iOPinData() const;
+  //! @throw AdditionalFieldMissing if the frame contains no measurements.
+  const std::vector<double>& measurements() const;
+  //! @throw AdditionalFieldMissing if the frame contains no intensities.
+  const std::vector<double>& intensities() const;
+  //! @throw AdditionalFieldMissing if the frame contains no intensities.
+  //! @see Message::intensityFlags()
+  const std::vector<uint8_t>& intensityFlags() const;
+  //! @throw AdditionalFieldMissing if the frame contains no diagnostic_messages.
+  const std::vector<diagnostic::Message>& diagnosticMessages() const;
+
+  //! @brief Returns the number of measurements without decoding them.
+  //! @throw AdditionalFieldMissing if the frame contains no measurements.
+  std::size_t numberOfMeasurements() const;
+  //! @brief Returns the number of intensities without decoding them.
+  //! @throw AdditionalFieldMissing if the frame contains no intensities.
+  std::size_t numberOfIntensities() const;
+
+  /**
+   * @brief Decodes the measurements straight into a buffer with space for numberOfMeasurements() values.
+   *
+   * In contrast to measurements() the result is not cached, which allows to decode several frames into one
+   * contiguous buffer. The uint16_t overload copies the raw samples without converting them.
+   *
+   * @throw AdditionalFieldMissing if the frame contains no measurements.
+   */
+  void decodeMeasurements(double* measurements) const;
+  void decodeMeasurements(float* measurements) const;
+  void decodeMeasurements(uint16_t* measurements) const;
+  /**
+   * @brief Decodes the intensities straight into a buffer with space for numberOfIntensities() values.
+   *
+   * @param packed_flags Buffer with space for numberOfIntensityFlagBytes(numberOfIntensities()) bytes.
+   * @throw AdditionalFieldMissing if the frame contains no intensities.
+   * @see decodeMeasurements()
+   */
+  void decodeIntensities(double* intensities, uint8_t* packed_flags) const;
+  void decodeIntensities(float* intensities, uint8_t* packed_flags) const;
+  //! @brief Copies the raw intensity samples, which still contain the flag bits.
+  void decodeIntensities(uint16_t* intensities) const;
+
+  bool hasScanCounterField() const;
+  bool hasActiveZonesetField() const;
+  bool hasIOPinField() const;
+  bool hasMeasurementsField() const;
+  bool hasIntensitiesField() const;
+  bool hasDiagnosticMessagesField() const;
+
+  //! @brief Decodes all fields contained in the frame into a Message.
+  Message toMessage() const;
+
+private:
+  //! @brief Position of the payload of an additional field within the raw data.
+  struct FieldLocation
+  {
+    std::size_t offset;
+    std::size_t length;
+  };
+
+  const char* fieldData(const FieldLocation& location) const;
+  const FieldLocation& measurementsLocation() const;
+  const FieldLocation& intensitiesLocation() const;
+  void decodeIntensities() const;
+
+private:
+  RawDataConstPtr data_;
+
+  // fixed fields
+  configuration::ScannerId scanner_id_{ configuration::ScannerId::master };
+  util::TenthOfDegree from_theta_{ 0 };
+  util::TenthOfDegree resolution_{ 1 };
+
+  // eagerly decoded additional fields
+  boost::optional<uint32_t> scan_counter_;
+  boost::optional<uint8_t> active_zoneset_;
+
+  // lazily decoded additional fields
+  boost::optional<FieldLocation> io_pin_data_location_;
+  boost::optional<FieldLocation> measurements_location_;
+  boost::optional<FieldLocation> intensities_location_;
+  boost::optional<FieldLocation> diagnostic_messages_location_;
+
+  mutable boost::optional<io::PinData> io_pin_data_;
+  mutable boost::optional<std::vector<double>> measurements_;
+  mutable boost::optional<std::vector<double>> intensities_;
+  mutable boost::optional<std::vector<uint8_t>> intensity_flags_;
+  mutable boost::optional<std::vector<diagnostic::Message>> diagnostic_messages_;
+};
+
+}  // namespace monitoring_frame
+}  // namespace data_conversion_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_MSG_VIEW_H
@@ -0,0 +1,134 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_SAMPLE_CONVERSION_H
+#define PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_SAMPLE_CONVERSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace psen_scan_v2_standalone
+{
+namespace data_conversion_layer
+{
+namespace monitoring_frame
+{
+/**
+ * @brief Lists the implementations available for the bulk conversion of the raw samples of a monitoring frame.
+ *
+ * All kernels produce bit-identical results. The vectorized ones are only available on x86 processors.
+ */
+enum class ConversionKernel
+{
+  scalar,
+  sse2,
+  avx2
+};
+
+/**
+ * @brief Returns the fastest kernel supported by the processor the driver is running on.
+ *
+ * The detection is done once at runtime, so the same binary can be used on processors with and without AVX2.
+ */
+ConversionKernel bestConversionKernel();
+
+std::string toString(const ConversionKernel& kernel);
+
+/**
+ * @brief Converts a packed block of raw little-endian uint16 distances (in mm) to meters.
+ *
+ * The special values NO_SIGNAL_ARRIVED and SIGNAL_TOO_LATE are mapped to +infinity.
+ *
+ * @param raw Pointer to the first raw sample, no alignment is required.
+ * @param number_of_samples Number of raw samples (2 bytes each) to convert.
+ * @param measurements Output buffer with space for at least number_of_samples values.
+ * @param kernel Implementation to use. Kernels not supported by the processor fall back to the best supported one.
+ */
+void convertRawMeasurements(const char* raw,
+                            const std::size_t& number_of_samples,
+                            double* measurements,
+                            const ConversionKernel& kernel = bestConversionKernel());
+
+//! @brief Single precision variant of convertRawMeasurements(), dividing in single precision.
+void convertRawMeasurements(const char* raw,
+                            const std::size_t& number_of_samples,
+                            float* measurements,
+                            const ConversionKernel& kernel = bestConversionKernel());
+
+/**
+ * @brief Copies a packed block of raw little-endian uint16 samples without converting them.
+ *
+ * Special values and intensity flag bits are kept as sent by the scanner.
+ *
+ * @param raw Pointer to the first raw sample, no alignment is required.
+ * @param number_of_samples Number of raw samples (2 bytes each) to copy.
+ * @param samples Output buffer with space for at least number_of_samples values.
+ */
+void copyRawSamples(const char* raw, const std::size_t& number_of_samples, uint16_t* samples);
+
+//! @brief Number of samples whose two intensity flag bits are packed into one byte.
+static constexpr std::size_t INTENSITY_FLAGS_PER_BYTE{ 4 };
+//! @brief Mask of the intensity value, the two highest bits of a raw intensity sample are flags.
+static constexpr uint16_t INTENSITY_VALUE_MASK{ 0b0011111111111111 };
+static constexpr uint16_t INTENSITY_FLAGS_SHIFT{ 14 };
+
+//! @brief Returns the number of bytes needed to store the packed intensity flags of number_of_samples samples.
+constexpr std::size_t numberOfIntensityFlagBytes(const std::size_t& number_of_samples)
+{
+  return (number_of_samples + INTENSITY_FLAGS_PER_BYTE - 1) / INTENSITY_FLAGS_PER_BYTE;
+}
+
+/**
+ * @brief Returns the two flag bits (0..3) stripped from the raw intensity sample with the given index.
+ *
+ * @see convertRawIntensities()
+ */
+inline uint8_t intensityFlags(const uint8_t* packed_flags, const std::size_t& sample_index)
+{
+  return (packed_flags[sample_index / INTENSITY_FLAGS_PER_BYTE] >> (2 * (sample_index % INTENSITY_FLAGS_PER_BYTE))) &
+         0b11;
+}
+
+/**
+ * @brief Converts a packed block of raw little-endian uint16 intensity samples.
+ *
+ * The lower 14 bits of each sample are the intensity value. The two highest bits are not part of the value, they are
+ * stored in packed_flags instead: the flags of sample i are found in byte i / 4 at bit position 2 * (i % 4).
+ *
+ * @param raw Pointer to the first raw sample, no alignment is required.
+ * @param number_of_samples Number of raw samples (2 bytes each) to convert.
+ * @param intensities Output buffer with space for at least number_of_samples values.
+ * @param packed_flags Output buffer with space for at least numberOfIntensityFlagBytes(number_of_samples) bytes.
+ * @param kernel Implementation to use. Kernels not supported by the processor fall back to the best supported one.
+ */
+void convertRawIntensities(const char* raw,
+                           const std::size_t& number_of_samples,
+                           double* intensities,
+                           uint8_t* packed_flags,
+                           const ConversionKernel& kernel = bestConversionKernel());
+
+//! @brief Single precision variant of convertRawIntensities().
+void convertRawIntensities(const char* raw,
+                           const std::size_t& number_of_samples,
+                           float* intensities,
+                           uint8_t* packed_flags,
+                           const ConversionKernel& kernel = bestConversionKernel());
+
+}  // namespace monitoring_frame
+}  // namespace data_conversion_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_SAMPLE_CONVERSION_H
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <functional>
 #include <istream>
 #include <sstream>
@@ -119,10 +120,140 @@ inline T toArray(std::ostringstream& os)
   return raw_data;
 }
 
+/**
+ * @brief Exception thrown if more data are read from a RawDataReader than available.
+ */
+class RawDataReadFailure : public std::runtime_error
+{
+public:
+  RawDataReadFailure(const std::string& msg = "Error in raw data processing");
+};
+
+/**
+ * @brief Bounds-checked cursor reading values directly from a contiguous raw data buffer.
+ *
+ * In contrast to the std::istream based functions, the data are neither copied nor is any memory allocated.
+ * The reader does not own the buffer, so the buffer has to outlive the reader.
+ */
+class RawDataReader
+{
+public:
+  RawDataReader(const char* data, const std::size_t& num_bytes);
+
+public:
+  template <typename T>
+  void read(T& data);
+  //! @brief Moves the cursor forward without interpreting the skipped bytes.
+  void skip(const std::size_t& num_bytes);
+
+  //! @brief Returns a pointer to the byte at the current cursor position.
+  const char* current() const;
+  std::size_t position() const;
+  std::size_t remaining() const;
+
+private:
+  void ensureAvailable(const std::size_t& num_bytes) const;
+
+private:
+  const char* const data_;
+  const std::size_t num_bytes_;
+  std::size_t position_{ 0 };
+};
+
+inline RawDataReader::RawDataReader(const char* data, const std::size_t& num_bytes) : data_(data), num_bytes_(num_bytes)
+{
+}
+
+template <typename T>
+inline void RawDataReader::read(T& data)
+{
+  ensureAvailable(sizeof(T));
+  std::memcpy(&data, data_ + position_, sizeof(T));
+  position_ += sizeof(T);
+}
+
+inline void RawDataReader::skip(const std::size_t& num_bytes)
+{
+  ensureAvailable(num_bytes);
+  position_ += num_bytes;
+}
+
+inline const char* RawDataReader::current() const
+{
+  return data_ + position_;
+}
+
+inline std::size_t RawDataReader::position() const
+{
+  return position_;
+}
+
+inline std::size_t RawDataReader::remaining() const
+{
+  return num_bytes_ - position_;
+}
+
+inline void RawDataReader::ensureAvailable(const std::size_t& num_bytes) const
+{
+  if (num_bytes > remaining())
+  {
+    throw RawDataReadFailure(
+        fmt::format("Failure reading {} bytes from raw data, only {} bytes left.", num_bytes, remaining()));
+  }
+}
+
+template <typename T>
+inline void read(RawDataReader& reader, T& data)
+{
+  reader.read(data);
+}
+
+template <typename T>
+inline T read(RawDataReader& reader)
+{
+  T retval;
+  reader.read(retval);
+  return retval;
+}
+
+template <typename RawType, typename ReturnType>
+inline ReturnType read(RawDataReader& reader)
+{
+  return ReturnType(raw_processing::read<RawType>(reader));
+}
+
+/**
+ * @brief Reads number_of_samples values of RawType at once and appends them converted to data.
+ *
+ * The bounds are checked once for the whole array. The conversion is passed as template parameter so that it can be
+ * inlined instead of being called through a std::function.
+ */
+template <typename RawType, typename ReturnType, typename Conversion>
+inline void readArray(RawDataReader& reader,
+                      std::vector<ReturnType>& data,
+                      const size_t& number_of_samples,
+                      const Conversion& conversion_fcn)
+{
+  const char* raw = reader.current();
+  reader.skip(number_of_samples * sizeof(RawType));
+
+  data.reserve(data.size() + number_of_samples);
+  for (size_t i = 0; i < number_of_samples; ++i)
+  {
+    RawType raw_value;
+    std::memcpy(&raw_value, raw + i * sizeof(RawType), sizeof(RawType));
+    data.push_back(conversion_fcn(raw_value));
+  }
+}
+
 inline StringStreamFailure::StringStreamFailure(const std::string& msg) : std::runtime_error(msg)
 {
 }
 
+inline RawDataReadFailure::RawDataReadFailure(const std::string& msg) : std::runtime_error(msg)
+{
+}
+
 }  // namespace raw_processing
 }  // namespace data_conversion_layer
 }  // namespace psen_scan_v2_standalone
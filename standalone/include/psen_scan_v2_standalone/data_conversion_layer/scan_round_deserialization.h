@@ -0,0 +1,90 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_SCAN_ROUND_DESERIALIZATION_H
+#define PSEN_SCAN_V2_STANDALONE_SCAN_ROUND_DESERIALIZATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/laserscan_conversions.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_decode_options.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace data_conversion_layer
+{
+namespace monitoring_frame
+{
+/**
+ * @brief Raw monitoring frame as received from the scanner together with the time of its reception.
+ *
+ * @see MessageStamped
+ */
+struct RawFrameStamped
+{
+  RawFrameStamped(const RawDataConstPtr& data, const std::size_t& num_bytes, const int64_t timestamp)
+    : data_(data), num_bytes_(num_bytes), stamp_(timestamp){};
+  RawDataConstPtr data_;
+  std::size_t num_bytes_;
+  int64_t stamp_;
+};
+}  // namespace monitoring_frame
+
+/**
+ * @brief Decodes all raw monitoring frames of a scan round at once into a LaserScan.
+ *
+ * In contrast to deserializing every frame and passing the messages to LaserScanConverter::toLaserScan(), the
+ * measurements and intensities are not decoded into per-frame vectors which are concatenated afterwards. Instead the
+ * fixed fields and field headers of all frames are read first, which allows to validate the round and to allocate the
+ * scan data once. The samples of each frame are then converted straight into the scan data at the offset given by the
+ * frame's angle.
+ *
+ * The resulting LaserScan is the same as the one created by LaserScanConverter::toLaserScan(). Intensities and IO
+ * states are skipped if they are deselected in the options. Intensities are only provided if every frame contains
+ * them. Measurements, scan counter and active zoneset are always needed to create a LaserScan.
+ *
+ * @param frames The frames of one scan round in reception order.
+ * @param scan Is only assigned if ScanConversionStatus::ok is returned.
+ *
+ * @throws monitoring_frame::DecodingFailure if one of the frames is malformed.
+ * @throws monitoring_frame::AdditionalFieldUnexpectedSize if a field with fixed size has an unexpected length.
+ * @throws monitoring_frame::AdditionalFieldMissing if measurements, scan_counter or active_zoneset are not set in one
+ * of the frames.
+ *
+ * @see LaserScanConverter::tryToLaserScan()
+ */
+ScanConversionStatus tryDeserializeScanRound(const std::vector<monitoring_frame::RawFrameStamped>& frames,
+                                             const monitoring_frame::DecodeOptions& options,
+                                             boost::optional<LaserScan>& scan);
+
+/**
+ * @brief Variant of tryDeserializeScanRound() throwing if the frames do not form a valid scan round.
+ *
+ * @throws ScannerProtocolViolationError if the frames do not form a valid scan round.
+ * @see tryDeserializeScanRound()
+ */
+LaserScan deserializeScanRound(const std::vector<monitoring_frame::RawFrameStamped>& frames,
+                               const monitoring_frame::DecodeOptions& options = monitoring_frame::DecodeOptions());
+
+}  // namespace data_conversion_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_SCAN_ROUND_DESERIALIZATION_H
@@ -16,7 +16,9 @@
 #ifndef PSEN_SCAN_V2_STANDALONE_LASERSCAN_H
 #define PSEN_SCAN_V2_STANDALONE_LASERSCAN_H
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <ostream>
 #include <vector>
 
@@ -40,6 +42,15 @@ namespace psen_scan_v2_standalone
  * - ID of the currently active zoneset.
  * - Time of the first scan ray.
  * - All states of the I/O pins recorded during the scan.
+ * - Number of measurements missing in a partial scan.
+ *
+ * If single precision is enabled in the ScannerConfiguration, measurements and intensities are stored as float and
+ * are accessible via singlePrecisionMeasurements() and singlePrecisionIntensities(), while measurements() and
+ * intensities() stay empty. Likewise, if raw samples are enabled, the unconverted samples sent by the scanner are
+ * accessible via rawMeasurements() and rawIntensities().
+ *
+ * The setters taking an rvalue reference, as well as the constructor taking the samples, take over the passed data
+ * without copying it.
  *
  * The measures use the target frame defined as \<tf_prefix\>.
  * @see https://github.com/PilzDE/psen_scan_v2_standalone/blob/main/README.md#tf-frames
@@ -50,6 +61,13 @@ public:
   using MeasurementData = std::vector<double>;
   using IntensityData = std::vector<double>;
   using IOData = std::vector<IOState>;
+  using SinglePrecisionMeasurementData = std::vector<float>;
+  using SinglePrecisionIntensityData = std::vector<float>;
+  using RawMeasurementData = std::vector<uint16_t>;
+  using RawIntensityData = std::vector<uint16_t>;
+
+  //! @brief Raw measurement filling the gaps of a partial scan, the scanner itself never sends this value.
+  static constexpr uint16_t MISSING_RAW_MEASUREMENT{ 0xFFFF };
 
 public:
   LaserScan(const util::TenthOfDegree& resolution,
@@ -59,6 +77,17 @@ public:
             const uint8_t active_zoneset,
             const int64_t timestamp,
             const configuration::ScannerId scanner_id);
+  //! @brief Creates a scan which takes over the passed measurements, intensities and io states.
+  LaserScan(const util::TenthOfDegree& resolution,
+            const util::TenthOfDegree& min_scan_angle,
+            const util::TenthOfDegree& max_scan_angle,
+            const uint32_t scan_counter,
+            const uint8_t active_zoneset,
+            const int64_t timestamp,
+            const configuration::ScannerId scanner_id,
+            MeasurementData measurements,
+            IntensityData intensities = IntensityData(),
+            IOData io_states = IOData());
 
 public:
   /*! deprecated: use const util::TenthOfDegree& scanResolution() const instead */
@@ -101,6 +130,7 @@ public:
   [[deprecated("use void measurements(const MeasurementData& measurements) instead")]] void
   setMeasurements(const MeasurementData& measurements);
   void measurements(const MeasurementData& measurements);
+  void measurements(MeasurementData&& measurements);
 
   /*! deprecated: use const IntensityData& intensities() instead */
   [[deprecated("use const IntensityData& intensities() const instead")]] const IntensityData& getIntensities() const;
@@ -112,6 +142,7 @@ public:
   [[deprecated("use void intensities(const IntensityData& intensities)) instead")]] void
   setIntensities(const IntensityData& intensities);
   void intensities(const IntensityData& intensities);
+  void intensities(IntensityData&& intensities);
 
   /*! deprecated: use const IOData& ioStates() const instead */
   [[deprecated("use const IOData& ioStates() const instead")]] const IOData& getIOStates() const;
@@ -120,12 +151,64 @@ public:
   /*! deprecated: use void ioStates(const IOData& io_states) instead */
   [[deprecated("use void ioStates(const IOData& io_states) instead")]] void setIOStates(const IOData& io_states);
   void ioStates(const IOData& io_states);
+  void ioStates(IOData&& io_states);
+
+  const SinglePrecisionMeasurementData& singlePrecisionMeasurements() const;
+  void singlePrecisionMeasurements(const SinglePrecisionMeasurementData& measurements);
+  void singlePrecisionMeasurements(SinglePrecisionMeasurementData&& measurements);
+
+  const SinglePrecisionIntensityData& singlePrecisionIntensities() const;
+  void singlePrecisionIntensities(const SinglePrecisionIntensityData& intensities);
+  void singlePrecisionIntensities(SinglePrecisionIntensityData&& intensities);
+
+  //! @brief Returns true if the measurements and intensities of this scan are stored in single precision.
+  bool isSinglePrecision() const;
+
+  //! @brief Distances in mm as sent by the scanner, special values like NO_SIGNAL_ARRIVED are not mapped.
+  const RawMeasurementData& rawMeasurements() const;
+  void rawMeasurements(const RawMeasurementData& measurements);
+  void rawMeasurements(RawMeasurementData&& measurements);
+
+  //! @brief Intensities as sent by the scanner, including the two flag bits of each sample.
+  const RawIntensityData& rawIntensities() const;
+  void rawIntensities(const RawIntensityData& intensities);
+  void rawIntensities(RawIntensityData&& intensities);
+
+  //! @brief Returns true if the measurements and intensities of this scan are stored as raw samples.
+  bool hasRawSamples() const;
+
+  /**
+   * @brief Returns the number of measurements missing in a scan, which was passed on before all of its frames arrived.
+   *
+   * The missing measurements and intensities are NaN, or MISSING_RAW_MEASUREMENT and 0 respectively for raw
+   * samples.
+   *
+   * @see ScannerConfigurationBuilder::enablePartialScans()
+   */
+  std::size_t numberOfMissingMeasurements() const;
+  void numberOfMissingMeasurements(const std::size_t& number_of_missing_measurements);
+  //! @brief Returns true if measurements of this scan are missing.
+  bool isPartial() const;
 
 private:
   //! Measurement data of the laserscan (in Millimeters).
   MeasurementData measurements_;
   //! Stores the received normalized signal intensities.
   IntensityData intensities_;
+  //! Measurement data of the laserscan, if stored in single precision.
+  SinglePrecisionMeasurementData single_precision_measurements_;
+  //! Signal intensities, if stored in single precision.
+  SinglePrecisionIntensityData single_precision_intensities_;
+  //! Set as soon as single precision data is assigned.
+  bool single_precision_{ false };
+  //! Unconverted distance samples in mm, if raw samples are enabled.
+  RawMeasurementData raw_measurements_;
+  //! Unconverted intensity samples, if raw samples are enabled.
+  RawIntensityData raw_intensities_;
+  //! Set as soon as raw data is assigned.
+  bool raw_samples_{ false };
+  //! Measurements which are missing, because frames of the scan round did not arrive in time.
+  std::size_t missing_measurements_{ 0 };
   //! States of the I/O pins.
   IOData io_states_;
   //! Distance of angle between the measurements.
@@ -144,6 +227,9 @@ private:
   configuration::ScannerId scanner_id_;
 };
 
+//! @brief Shared ownership of a scan, which allows several consumers to retain it without copying.
+using LaserScanConstPtr = std::shared_ptr<const LaserScan>;
+
 std::ostream& operator<<(std::ostream& os, const LaserScan& scan);
 
 }  // namespace psen_scan_v2_standalone
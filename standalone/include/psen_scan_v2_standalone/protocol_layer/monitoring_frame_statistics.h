@@ -0,0 +1,50 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_STATISTICS_H
+#define PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_STATISTICS_H
+
+#include <cstdint>
+
+namespace psen_scan_v2_standalone
+{
+namespace protocol_layer
+{
+/**
+ * @brief Counts the monitoring frames and scan rounds which could not be passed to the user.
+ *
+ * Those conditions occur regularly on lossy networks. They are therefore not reported by exceptions, but counted,
+ * so that no data is lost silently.
+ */
+struct MonitoringFrameStatistics
+{
+  //! Frames which could not be deserialized.
+  uint64_t malformed_frames{ 0 };
+  //! Frames which were dropped because they belong to an earlier scan round.
+  uint64_t outdated_frames{ 0 };
+  //! Incomplete scan rounds which were dropped because the next round started.
+  uint64_t rounds_ended_early{ 0 };
+  //! Scan rounds which received more frames than expected.
+  uint64_t oversaturated_rounds{ 0 };
+  //! Scan rounds (or fragments) whose frames could not be converted into a LaserScan.
+  uint64_t rejected_scans{ 0 };
+  //! Incomplete scan rounds which were passed on as partial scans.
+  uint64_t partial_scans{ 0 };
+};
+
+}  // namespace protocol_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_MONITORING_FRAME_STATISTICS_H
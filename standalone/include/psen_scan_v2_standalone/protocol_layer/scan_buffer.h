@@ -16,16 +16,55 @@
 #ifndef PSEN_SCAN_V2_STANDALONE_SCAN_ROUND_H
 #define PSEN_SCAN_V2_STANDALONE_SCAN_ROUND_H
 
+#include <algorithm>
+#include <cstdint>
 #include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
 
 #include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg.h"
 #include "psen_scan_v2_standalone/util/logging.h"
+#include "psen_scan_v2_standalone/configuration/default_parameters.h"
 #include "psen_scan_v2_standalone/configuration/scanner_ids.h"
 
 namespace psen_scan_v2_standalone
 {
 namespace protocol_layer
 {
+/**
+ * @brief Outcome of ScanBuffer::tryAdd().
+ */
+enum class ScanBufferStatus
+{
+  //! The frame was added to the current scan round.
+  added,
+  //! The frame was dropped on purpose, because it is the unreliable first frame of subscriber0.
+  ignored,
+  //! The frame was dropped, because it belongs to a scan round which is no longer within the reorder window or which
+  //! was already handed off by takeOverdueRound().
+  outdated,
+  //! The frame was added, but the new scan round it started pushed an incomplete round out of the reorder window.
+  //! The incomplete round was dropped.
+  round_ended_early,
+  //! The frame was added, but the current scan round now has more frames than expected.
+  oversaturated
+};
+
+static constexpr const char* OUTDATED_MESSAGE_ERROR_MSG{
+  "Detected a MonitoringFrame from an earlier round. The scan round will ignore it."
+};
+static constexpr const char* SCAN_ROUND_ENDED_EARLY_ERROR_MSG{
+  "Detected a MonitoringFrame from a new scan round before the old one was complete. Dropping the incomplete round. "
+  "(Please check the ethernet connection or contact PILZ support if the error persists.)"
+};
+static constexpr const char* SCAN_ROUND_OVERSATURATED_ERROR_MSG{
+  "Received too many MonitoringFrames for one scan round."
+};
+
 /**
  * @brief Exception indicating problems with the monitoring frames of a scan round.
  */
@@ -41,9 +80,7 @@ public:
 class OutdatedMessageError : public ScanRoundError
 {
 public:
-  OutdatedMessageError(const std::string& msg = "Detected a MonitoringFrame from an earlier round. "
-                                                "The scan round will ignore it.")
-    : ScanRoundError(msg){};
+  OutdatedMessageError(const std::string& msg = OUTDATED_MESSAGE_ERROR_MSG) : ScanRoundError(msg){};
 };
 
 /**
@@ -52,12 +89,7 @@ public:
 class ScanRoundEndedEarlyError : public ScanRoundError
 {
 public:
-  ScanRoundEndedEarlyError(const std::string& msg = "Detected a MonitoringFrame from a new scan round before the old "
-                                                    "one was complete."
-                                                    " Dropping the incomplete round."
-                                                    " (Please check the ethernet connection or contact PILZ support if "
-                                                    "the error persists.)")
-    : ScanRoundError(msg){};
+  ScanRoundEndedEarlyError(const std::string& msg = SCAN_ROUND_ENDED_EARLY_ERROR_MSG) : ScanRoundError(msg){};
 };
 
 /**
@@ -66,8 +98,7 @@ public:
 class ScanRoundOversaturatedError : public ScanRoundError
 {
 public:
-  ScanRoundOversaturatedError(const std::string& msg = "Received too many MonitoringFrames for one scan round.")
-    : ScanRoundError(msg){};
+  ScanRoundOversaturatedError(const std::string& msg = SCAN_ROUND_OVERSATURATED_ERROR_MSG) : ScanRoundError(msg){};
 };
 
 /**
@@ -76,101 +107,328 @@ public:
  * Discovers if there are to many monitoring frames in a scan round.
  * Informs when a scan round ended incomplete.
  * Discovers and omits old messages.
+ *
+ * To tolerate frames arriving out of order, the buffer can keep the rounds preceding the newest one open for a
+ * number of rounds given by the reorder window. A round is complete as soon as its last missing frame arrives, even if
+ * newer rounds started in the meantime. An incomplete round is dropped once it falls out of the window. With a reorder
+ * window of 0 the start of a new round ends the previous one.
+ *
+ * The frames are stored in a fixed number of slots, which are allocated on construction. Each frame is placed in the
+ * slot given by its angular position within the round, so a complete round is ordered by fromTheta independent of the
+ * order in which the frames arrived. Frames exceeding the expected number are reported, but not stored.
+ *
+ * A complete round is handed off with takeRound(), which swaps the slots with a second preallocated set instead of
+ * copying the frames. Frames passed as rvalue are moved into their slot, so once the slots have been in use, adding
+ * frames and handing off rounds does not allocate memory.
+ *
+ * An incomplete round can be handed off before it falls out of the window with takeOverdueRound(), to pass it on as
+ * partial scan once its frames are overdue.
  */
 class ScanBuffer
 {
 public:
-  ScanBuffer(const uint32_t& num_expected_msgs);
   /**
-   * @brief Adds the message to the current scan round.
+   * @param num_expected_msgs Number of frames of a complete round.
+   * @param reorder_window Number of rounds preceding the newest one which still accept frames.
+   *
+   * @throws std::invalid_argument if reorder_window exceeds configuration::MAX_SCAN_ROUND_REORDER_WINDOW.
+   */
+  ScanBuffer(const uint32_t& num_expected_msgs, const uint32_t& reorder_window = 0);
+
+  /**
+   * @brief Adds the message to its scan round.
    *
    * @note:
-   * A scan round is considered to be complete whenever the next scan round starts or the expected number of messages
-   * arrived.
+   * A scan round is considered to be complete whenever it falls out of the reorder window or the expected number of
+   * messages arrived.
    *
    * @param stamped_msg Current received MonitoringFrame.
    *
    * @throws data_conversion_layer::monitoring_frame::AdditionalFieldMissing if scan_counter is not set in
    * stamped_msg.msg_.
+   * @throws OutdatedMessageError, ScanRoundEndedEarlyError or ScanRoundOversaturatedError corresponding to the status
+   * returned by tryAdd().
    */
   void add(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg);
+  void add(data_conversion_layer::monitoring_frame::MessageStamped&& stamped_msg);
+
+  /**
+   * @brief Variant of add() for the per-frame path, reporting unexpected frames by the returned status.
+   *
+   * @throws data_conversion_layer::monitoring_frame::AdditionalFieldMissing if scan_counter is not set in
+   * stamped_msg.msg_.
+   */
+  ScanBufferStatus tryAdd(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg);
+  //! @brief Variant of tryAdd() which moves the message into its slot instead of copying it.
+  ScanBufferStatus tryAdd(data_conversion_layer::monitoring_frame::MessageStamped&& stamped_msg);
 
   /**
    * @brief Readies the validator for a new validation round. This function has to be called whenever
    * there is an expected brake in the receiving of MonitoringFrames.
    */
   void reset();
-  std::vector<data_conversion_layer::monitoring_frame::MessageStamped> currentRound();
+  //! @brief Returns the frames of the newest round stored so far, ordered by their angular position.
+  const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& currentRound() const;
 
-  bool isRoundComplete();
+  /**
+   * @brief Hands off the frames of the round the last added frame belongs to without copying them.
+   *
+   * The returned frames stay valid until the next call of takeRound(). The scan counter of the round is kept, so late
+   * frames of it are still reported as oversaturated or outdated.
+   */
+  const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& takeRound();
+
+  //! @brief Returns true if the expected number of frames arrived for the round the last added frame belongs to.
+  bool isRoundComplete() const;
+
+  /**
+   * @brief Hands off the oldest incomplete round which is overdue on arrival of next_msg without copying it.
+   *
+   * A round is overdue if its first frame arrived at least round_deadline ns before next_msg, or if next_msg starts a
+   * round which would push it out of the reorder window. Frames of the round arriving afterwards are reported as
+   * outdated. The first round is never handed off, because the driver may have started in the middle of it. The round
+   * next_msg belongs to is not handed off either, so that a late frame still completes its own round.
+   *
+   * Call this function before adding next_msg and repeat it until it returns nullptr.
+   *
+   * @returns The frames of the overdue round, which stay valid until the next call of takeRound() or
+   * takeOverdueRound(), or nullptr if no round is overdue.
+   * @throws data_conversion_layer::monitoring_frame::AdditionalFieldMissing if scan_counter is not set in
+   * next_msg.msg_.
+   */
+  const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>*
+  takeOverdueRound(const data_conversion_layer::monitoring_frame::MessageStamped& next_msg,
+                   const int64_t& round_deadline);
 
 private:
-  void startNewRound(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg);
+  //! @brief Frames of one scan round within the reorder window.
+  struct Round
+  {
+    boost::optional<uint32_t> scan_counter;
+    std::vector<data_conversion_layer::monitoring_frame::MessageStamped> msgs;
+    //! Number of frames received for the round, including those which were handed off or not stored.
+    uint32_t num_msgs{ 0 };
+    //! The first round after construction may be incomplete, because the driver started in the middle of it.
+    bool report_if_incomplete{ false };
+    //! Time stamp of the first frame received for the round.
+    int64_t first_stamp{ 0 };
+    //! Set if the incomplete round was handed off by takeOverdueRound().
+    bool handed_off{ false };
+  };
+
+  std::size_t slotIndex(const uint32_t& scan_counter) const;
+  void openRound(const uint32_t& scan_counter, const int64_t& stamp);
+  //! @brief Closes the rounds which fell out of the reorder window and returns true if one of them was incomplete.
+  bool closeRoundsOutsideWindow();
+  ScanBufferStatus addToRound(const std::size_t& index,
+                              data_conversion_layer::monitoring_frame::MessageStamped&& stamped_msg);
 
 private:
-  std::vector<data_conversion_layer::monitoring_frame::MessageStamped> current_round_{};
   const uint32_t num_expected_msgs_;
+  const uint32_t reorder_window_;
+  //! Slots for the rounds within the reorder window, the round with scan counter c is stored at slotIndex(c).
+  std::vector<Round> rounds_;
+  std::vector<data_conversion_layer::monitoring_frame::MessageStamped> completed_round_{};
+  boost::optional<uint32_t> newest_scan_counter_;
+  std::size_t last_round_index_{ 0 };
   bool first_scan_round_ = true;
 };
 
-inline ScanBuffer::ScanBuffer(const uint32_t& num_expected_msgs) : num_expected_msgs_(num_expected_msgs)
+inline ScanBuffer::ScanBuffer(const uint32_t& num_expected_msgs, const uint32_t& reorder_window)
+  : num_expected_msgs_(num_expected_msgs), reorder_window_(reorder_window)
 {
+  if (reorder_window_ > configuration::MAX_SCAN_ROUND_REORDER_WINDOW)
+  {
+    throw std::invalid_argument("The reorder window of the scan buffer must not exceed " +
+                                std::to_string(configuration::MAX_SCAN_ROUND_REORDER_WINDOW) + " rounds.");
+  }
+  rounds_.resize(reorder_window_ + 1);
+  for (auto& round : rounds_)
+  {
+    round.msgs.reserve(num_expected_msgs_);
+  }
+  completed_round_.reserve(num_expected_msgs_);
 }
 
 inline void ScanBuffer::reset()
 {
-  current_round_.clear();
+  for (auto& round : rounds_)
+  {
+    round.scan_counter = boost::none;
+    round.msgs.clear();
+    round.num_msgs = 0;
+    round.handed_off = false;
+  }
+  newest_scan_counter_ = boost::none;
+}
+
+inline const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& ScanBuffer::currentRound() const
+{
+  // Without a newest round all slots are empty.
+  return rounds_[newest_scan_counter_ ? slotIndex(newest_scan_counter_.get()) : 0].msgs;
+}
+
+inline const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& ScanBuffer::takeRound()
+{
+  completed_round_.clear();
+  completed_round_.swap(rounds_[last_round_index_].msgs);
+  return completed_round_;
 }
 
-inline std::vector<data_conversion_layer::monitoring_frame::MessageStamped> ScanBuffer::currentRound()
+inline bool ScanBuffer::isRoundComplete() const
 {
-  return current_round_;
+  const Round& round{ rounds_[last_round_index_] };
+  return round.scan_counter.is_initialized() && round.num_msgs == num_expected_msgs_;
 }
 
-inline bool ScanBuffer::isRoundComplete()
+inline const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>*
+ScanBuffer::takeOverdueRound(const data_conversion_layer::monitoring_frame::MessageStamped& next_msg,
+                             const int64_t& round_deadline)
 {
-  return current_round_.size() == num_expected_msgs_;
+  const uint32_t next_scan_counter{ next_msg.msg_.scanCounter() };
+  Round* overdue_round{ nullptr };
+  for (auto& round : rounds_)
+  {
+    if (!round.scan_counter.is_initialized() || round.handed_off || !round.report_if_incomplete ||
+        round.num_msgs >= num_expected_msgs_ || round.scan_counter.get() == next_scan_counter)
+    {
+      continue;
+    }
+    const uint32_t scan_counter{ round.scan_counter.get() };
+    const bool deadline_passed{ next_msg.stamp_ - round.first_stamp >= round_deadline };
+    const bool leaves_window{ next_scan_counter > scan_counter && next_scan_counter - scan_counter > reorder_window_ };
+    if ((deadline_passed || leaves_window) &&
+        (overdue_round == nullptr || scan_counter < overdue_round->scan_counter.get()))
+    {
+      overdue_round = &round;
+    }
+  }
+  if (overdue_round == nullptr)
+  {
+    return nullptr;
+  }
+  overdue_round->handed_off = true;
+  completed_round_.clear();
+  completed_round_.swap(overdue_round->msgs);
+  return &completed_round_;
 }
 
 inline void ScanBuffer::add(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg)
+{
+  add(data_conversion_layer::monitoring_frame::MessageStamped(stamped_msg));
+}
+
+inline void ScanBuffer::add(data_conversion_layer::monitoring_frame::MessageStamped&& stamped_msg)
+{
+  switch (tryAdd(std::move(stamped_msg)))
+  {
+    case ScanBufferStatus::outdated:
+      throw OutdatedMessageError();
+    case ScanBufferStatus::round_ended_early:
+      throw ScanRoundEndedEarlyError();
+    case ScanBufferStatus::oversaturated:
+      throw ScanRoundOversaturatedError();
+    default:
+      break;
+  }
+}
+
+inline ScanBufferStatus
+ScanBuffer::tryAdd(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg)
+{
+  return tryAdd(data_conversion_layer::monitoring_frame::MessageStamped(stamped_msg));
+}
+
+inline ScanBufferStatus ScanBuffer::tryAdd(data_conversion_layer::monitoring_frame::MessageStamped&& stamped_msg)
 {
   // Condition to fix the bug of the first scanCounter data of the Subscriber0
   if (first_scan_round_ &&
       stamped_msg.msg_.scannerId() == psen_scan_v2_standalone::configuration::ScannerId::subscriber0)
   {
     first_scan_round_ = false;
+    return ScanBufferStatus::ignored;
   }
-  else
+
+  const uint32_t scan_counter{ stamped_msg.msg_.scanCounter() };
+  if (!newest_scan_counter_.is_initialized() || scan_counter > newest_scan_counter_.get())
   {
-    if (current_round_.empty() || stamped_msg.msg_.scanCounter() == current_round_[0].msg_.scanCounter())
-    {
-      current_round_.push_back(stamped_msg);
-      if (current_round_.size() > num_expected_msgs_)
-      {
-        throw ScanRoundOversaturatedError();
-      }
-    }
-    else if (stamped_msg.msg_.scanCounter() > current_round_[0].msg_.scanCounter())
-    {
-      startNewRound(stamped_msg);
-    }
-    else
+    newest_scan_counter_ = scan_counter;
+    const bool round_ended_early{ closeRoundsOutsideWindow() };
+    openRound(scan_counter, stamped_msg.stamp_);
+    addToRound(slotIndex(scan_counter), std::move(stamped_msg));
+    return round_ended_early ? ScanBufferStatus::round_ended_early : ScanBufferStatus::added;
+  }
+  if (newest_scan_counter_.get() - scan_counter > reorder_window_)
+  {
+    return ScanBufferStatus::outdated;
+  }
+  // The first frame of a round within the window may arrive after frames of newer rounds.
+  if (rounds_[slotIndex(scan_counter)].scan_counter != scan_counter)
+  {
+    openRound(scan_counter, stamped_msg.stamp_);
+  }
+  return addToRound(slotIndex(scan_counter), std::move(stamped_msg));
+}
+
+inline std::size_t ScanBuffer::slotIndex(const uint32_t& scan_counter) const
+{
+  return scan_counter % rounds_.size();
+}
+
+inline void ScanBuffer::openRound(const uint32_t& scan_counter, const int64_t& stamp)
+{
+  Round& round{ rounds_[slotIndex(scan_counter)] };
+  round.scan_counter = scan_counter;
+  round.msgs.clear();
+  round.num_msgs = 0;
+  round.first_stamp = stamp;
+  round.handed_off = false;
+  round.report_if_incomplete = !first_scan_round_;
+  first_scan_round_ = false;
+}
+
+inline bool ScanBuffer::closeRoundsOutsideWindow()
+{
+  bool incomplete_round_closed{ false };
+  for (auto& round : rounds_)
+  {
+    if (round.scan_counter.is_initialized() && newest_scan_counter_.get() - round.scan_counter.get() > reorder_window_)
     {
-      throw OutdatedMessageError();
+      incomplete_round_closed |= round.report_if_incomplete && !round.handed_off && round.num_msgs < num_expected_msgs_;
+      round.scan_counter = boost::none;
+      round.msgs.clear();
+      round.num_msgs = 0;
     }
   }
+  return incomplete_round_closed;
 }
 
-inline void ScanBuffer::startNewRound(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg)
+inline ScanBufferStatus ScanBuffer::addToRound(const std::size_t& index,
+                                               data_conversion_layer::monitoring_frame::MessageStamped&& stamped_msg)
 {
-  bool old_round_undersaturated = current_round_.size() < num_expected_msgs_;
-  reset();
-  current_round_.push_back(stamped_msg);
-  if (old_round_undersaturated && !first_scan_round_)
+  Round& round{ rounds_[index] };
+  if (round.handed_off)
   {
-    throw ScanRoundEndedEarlyError();
+    return ScanBufferStatus::outdated;
   }
-  first_scan_round_ = false;
+  ++round.num_msgs;
+  if (round.num_msgs > num_expected_msgs_)
+  {
+    return ScanBufferStatus::oversaturated;
+  }
+  last_round_index_ = index;
+  // The capacity was reserved on construction and at most num_expected_msgs_ frames are stored, so this never
+  // reallocates.
+  round.msgs.push_back(std::move(stamped_msg));
+  // Move the new frame to the slot of its angular position. Frames with equal position keep their order of arrival.
+  const auto slot{ std::upper_bound(round.msgs.begin(),
+                                    round.msgs.end() - 1,
+                                    round.msgs.back(),
+                                    [](const auto& lhs, const auto& rhs) {
+                                      return lhs.msg_.fromTheta() < rhs.msg_.fromTheta();
+                                    }) };
+  std::rotate(slot, round.msgs.end() - 1, round.msgs.end());
+  return ScanBufferStatus::added;
 }
 }  // namespace protocol_layer
 }  // namespace psen_scan_v2_standalone
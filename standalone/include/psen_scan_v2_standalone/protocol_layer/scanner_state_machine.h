@@ -22,6 +22,7 @@
 #include <chrono>
 #include <stdexcept>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include <boost/optional.hpp>
 
@@ -52,8 +53,10 @@
 #include "psen_scan_v2_standalone/data_conversion_layer/scanner_reply_serialization_deserialization.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
+#include "psen_scan_v2_standalone/protocol_layer/monitoring_frame_statistics.h"
 #include "psen_scan_v2_standalone/protocol_layer/scan_buffer.h"
 #include "psen_scan_v2_standalone/util/watchdog.h"
+#include "psen_scan_v2_standalone/configuration/default_parameters.h"
 #include "psen_scan_v2_standalone/configuration/scanner_ids.h"
 
 namespace psen_scan_v2_standalone
@@ -83,13 +86,17 @@ namespace e = psen_scan_v2_standalone::protocol_layer::scanner_events;
 
 static constexpr std::chrono::milliseconds WATCHDOG_TIMEOUT{ 1000 };
 static constexpr uint32_t DEFAULT_NUM_MSG_PER_ROUND{ 6 };
+//! Time after the first monitoring frame of an incomplete scan round, after which it is passed on as partial scan.
+static constexpr std::chrono::nanoseconds SCAN_ROUND_DEADLINE{ static_cast<int64_t>(configuration::TIME_PER_SCAN_IN_S *
+                                                                                    1000000000.0) };
 
 using ScannerStartedCallback = std::function<void()>;
 using ScannerStoppedCallback = std::function<void()>;
 using StartErrorCallback = std::function<void(const std::string&)>;
 using StopErrorCallback = std::function<void(const std::string&)>;
 using TimeoutCallback = std::function<void()>;
-using InformUserAboutLaserScanCallback = std::function<void(const LaserScan&)>;
+//! The scan is handed over to the callback, which may take it over without copying.
+using InformUserAboutLaserScanCallback = std::function<void(LaserScan&&)>;
 
 /**
  * @brief Interface to create event timeout callbacks.
@@ -139,6 +146,11 @@ public:
  * It also checks for internal errors of incoming messages and handles timeouts of the above mentioned actions by
  * creating watchdogs via IWatchdogFactory.
  *
+ * If partial scans are enabled, incomplete scan rounds are passed on after SCAN_ROUND_DEADLINE. The deadline is only
+ * checked on arrival of a monitoring frame and not by a timer, so the latency of a partial scan is not bounded if the
+ * scanner stops sending: The incomplete round received last is only passed on with the next frame, or not at all if
+ * no further frame arrives.
+ *
  * @see data_conversion_layer::start_request::Message
  * @see data_conversion_layer::stop_request
  * @see data_conversion_layer::scanner_reply::Message
@@ -158,7 +170,8 @@ public:
                      const ScannerStoppedCallback& scanner_stopped_callback,
                      const InformUserAboutLaserScanCallback& laser_scan_callback,
                      const TimeoutCallback& start_timeout_callback,
-                     const TimeoutCallback& monitoring_frame_timeout_callback);
+                     const TimeoutCallback& monitoring_frame_timeout_callback,
+                     boost::asio::io_service* io_service = nullptr);
 
 public:  // States
   STATE(Idle);
@@ -191,6 +204,12 @@ public:  // Guards
   bool isUnknownStartReply(scanner_events::RawReplyReceived const& reply_event);
   bool isRefusedStartReply(scanner_events::RawReplyReceived const& reply_event);
 
+public:
+  //! @brief Returns the counters of the monitoring frames and scan rounds which could not be passed to the user.
+  const MonitoringFrameStatistics& monitoringFrameStatistics() const;
+  //! @brief Returns the counters of the datagrams received on the data socket.
+  communication_layer::ReceiveStatistics dataReceiveStatistics() const;
+
 public:  // Replaces the default exception/no-transition responses
   template <class FSM, class Event>
   void exception_caught(Event const& event, FSM& fsm, std::exception& exception);  // NOLINT
@@ -263,13 +282,22 @@ private:
    * @throws data_conversion_layer::monitoring_frame::AdditionalFieldMissing if scan_counter, active_zoneset or
    * measurements is not set.
    */
-  void informUserAboutTheScanData(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg);
+  void informUserAboutTheScanData(data_conversion_layer::monitoring_frame::MessageStamped&& stamped_msg);
   /**
    * @throws data_conversion_layer::monitoring_frame::AdditionalFieldMissing if scan_counter, active_zoneset or
    * measurements is not set in one of the msgs.
    */
   void
   sendMessageWithMeasurements(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msg);
+  bool partialScansActive() const;
+  /**
+   * @brief Passes the incomplete rounds of scan_buffer, which are overdue on arrival of next_msg, on as partial scans.
+   *
+   * @throws data_conversion_layer::monitoring_frame::AdditionalFieldMissing if scan_counter, active_zoneset or
+   * measurements is not set in one of the msgs.
+   */
+  void sendOverdueRoundsAsPartialScans(ScanBuffer& scan_buffer,
+                                       const data_conversion_layer::monitoring_frame::MessageStamped& next_msg);
   /**
    * @throws data_conversion_layer::monitoring_frame::AdditionalFieldMissing if measurements is not set in one of the
    * msgs.
@@ -286,9 +314,19 @@ private:
 
   using ScannerId = psen_scan_v2_standalone::configuration::ScannerId;
   std::unordered_map<ScannerId, ScanBuffer> scan_buffers_{};
+  //! Angles of the last complete scan of each scanner, which partial scans are filled up to.
+  std::unordered_map<ScannerId, data_conversion_layer::ScanAngles> complete_scan_angles_{};
+  MonitoringFrameStatistics monitoring_frame_statistics_{};
 
   boost::optional<data_conversion_layer::monitoring_frame::Message> zoneset_reference_msg_;
 
+  //! Serialized once the host ip is known, so that retries are sent without serializing the request again.
+  //! All of them carry start_request::DEFAULT_SEQ_NUMBER.
+  data_conversion_layer::RawDataConstPtr start_request_data_;
+  const data_conversion_layer::RawDataConstPtr stop_request_data_{
+    std::make_shared<const data_conversion_layer::RawData>(data_conversion_layer::stop_request::serialize())
+  };
+
   // Udp Clients
   communication_layer::UdpClientImpl control_client_;
   communication_layer::UdpClientImpl data_client_;
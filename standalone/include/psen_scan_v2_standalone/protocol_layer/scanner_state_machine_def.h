@@ -31,18 +31,23 @@ inline ScannerProtocolDef::ScannerProtocolDef(const ScannerConfiguration& config
                                               const ScannerStoppedCallback& scanner_stopped_callback,
                                               const InformUserAboutLaserScanCallback& laser_scan_callback,
                                               const TimeoutCallback& start_timeout_callback,
-                                              const TimeoutCallback& monitoring_frame_timeout_callback)
+                                              const TimeoutCallback& monitoring_frame_timeout_callback,
+                                              boost::asio::io_service* io_service)
   : config_(config)
   , control_client_(control_msg_callback,
                     control_error_callback,
                     config_.hostUDPPortControl(),  // LCOV_EXCL_LINE Lcov bug?
                     config_.clientIp(),
-                    config_.scannerControlPort())
+                    config_.scannerControlPort(),
+                    data_conversion_layer::scanner_reply::Message::SIZE,
+                    io_service)
   , data_client_(data_msg_callback,
                  data_error_callback,
                  config_.hostUDPPortData(),  // LCOV_EXCL_LINE Lcov bug?
                  config_.clientIp(),
-                 config_.scannerDataPort())
+                 config_.scannerDataPort(),
+                 config_.maxFrameSize(),
+                 io_service)
   , scanner_started_callback_(scanner_started_callback)
   , scanner_stopped_callback_(scanner_stopped_callback)
   , start_error_callback_(start_error_callback)
@@ -51,11 +56,25 @@ inline ScannerProtocolDef::ScannerProtocolDef(const ScannerConfiguration& config
   , start_timeout_callback_(start_timeout_callback)
   , monitoring_frame_timeout_callback_(monitoring_frame_timeout_callback)
 {
-  scan_buffers_.insert(std::make_pair(ScannerId::master, ScanBuffer(DEFAULT_NUM_MSG_PER_ROUND)));
+  scan_buffers_.insert(
+      std::make_pair(ScannerId::master, ScanBuffer(DEFAULT_NUM_MSG_PER_ROUND, config_.scanRoundReorderWindow())));
   for (int i = 0; i < config.nrSubscribers(); i++)
   {
     ScannerId id = psen_scan_v2_standalone::configuration::subscriber_number_to_scanner_id(i);
-    scan_buffers_.insert(std::make_pair(id, ScanBuffer(1)));
+    scan_buffers_.insert(std::make_pair(id, ScanBuffer(1, config_.scanRoundReorderWindow())));
+  }
+  control_client_.applySocketOptions(config_.controlSocketOptions());
+  data_client_.applySocketOptions(config_.dataSocketOptions());
+  control_client_.applyThreadScheduling(config_.networkThreadScheduling());
+  data_client_.applyThreadScheduling(config_.networkThreadScheduling());
+  if (config_.kernelTimestampsEnabled() && !data_client_.enableKernelTimestamps())
+  {
+    PSENSCAN_WARN("StateMachine", "Kernel timestamps are not supported, the time of processing is used instead.");
+  }
+  // Allows to distinguish frames dropped by an overloaded host from frames lost on the network.
+  if (!data_client_.enableKernelDropCounter())
+  {
+    PSENSCAN_DEBUG("StateMachine", "Datagrams dropped by the kernel cannot be counted on this platform.");
   }
 }
 
@@ -91,7 +110,16 @@ void ScannerProtocolDef::Idle::on_exit(Event const& /*unused*/, FSM& fsm)  // NO
 {
   PSENSCAN_DEBUG("StateMachine", "Exiting state: Idle");
   fsm.control_client_.startAsyncReceiving();
-  fsm.data_client_.startAsyncReceiving();
+  if (fsm.config_.ioUringReceiveEnabled())
+  {
+    fsm.data_client_.startAsyncReceiving(communication_layer::ReceiveMode::continuous_io_uring);
+  }
+  else
+  {
+    fsm.data_client_.startAsyncReceiving(fsm.config_.batchedReceiveEnabled() ?
+                                             communication_layer::ReceiveMode::continuous_batched :
+                                             communication_layer::ReceiveMode::continuous);
+  }
 }
 
 template <class Event, class FSM>
@@ -155,8 +183,12 @@ inline void ScannerProtocolDef::sendStartRequest(const T& event)
     config_.hostIp(host_ip.to_ulong());
     PSENSCAN_INFO("StateMachine", "No host ip set! Using local ip: {}", host_ip.to_string());
   }
-  control_client_.write(
-      data_conversion_layer::start_request::serialize(data_conversion_layer::start_request::Message(config_)));
+  if (!start_request_data_)
+  {
+    start_request_data_ = std::make_shared<const data_conversion_layer::RawData>(
+        data_conversion_layer::start_request::serialize(data_conversion_layer::start_request::Message(config_)));
+  }
+  control_client_.write(start_request_data_);
 }
 
 inline void ScannerProtocolDef::handleStartRequestTimeout(const scanner_events::StartTimeout& event)
@@ -173,7 +205,7 @@ inline void ScannerProtocolDef::sendStopRequest(const T& event)
 {
   PSENSCAN_DEBUG("StateMachine", "Action: sendStopRequest");
   data_client_.stop();
-  control_client_.write(data_conversion_layer::stop_request::serialize());
+  control_client_.write(stop_request_data_);
 }
 
 inline void ScannerProtocolDef::handleMonitoringFrame(const scanner_events::RawMonitoringFrameReceived& event)
@@ -183,12 +215,25 @@ inline void ScannerProtocolDef::handleMonitoringFrame(const scanner_events::RawM
 
   try
   {
-    const data_conversion_layer::monitoring_frame::Message msg{ data_conversion_layer::monitoring_frame::deserialize(
-        *(event.data_), event.num_bytes_) };
+    data_conversion_layer::monitoring_frame::Message msg;
+    const data_conversion_layer::monitoring_frame::DecodingStatus status{
+      data_conversion_layer::monitoring_frame::tryDeserialize(
+          *(event.data_), event.num_bytes_, config_.decodeOptions(), msg)
+    };
+    if (status != data_conversion_layer::monitoring_frame::DecodingStatus::ok)
+    {
+      ++monitoring_frame_statistics_.malformed_frames;
+      PSENSCAN_WARN_THROTTLE(1 /* sec */,
+                             "StateMachine",
+                             "Dropped malformed monitoring frame ({}). {} malformed frames so far.",
+                             data_conversion_layer::monitoring_frame::toString(status),
+                             monitoring_frame_statistics_.malformed_frames);
+      return;
+    }
     checkForDiagnosticErrors(msg);
     checkForChangedActiveZoneset(msg);
-    const data_conversion_layer::monitoring_frame::MessageStamped stamped_msg{ msg, event.timestamp_ };
-    informUserAboutTheScanData(stamped_msg);
+    data_conversion_layer::monitoring_frame::MessageStamped stamped_msg{ std::move(msg), event.timestamp_ };
+    informUserAboutTheScanData(std::move(stamped_msg));
   }
   // LCOV_EXCL_START
   catch (const data_conversion_layer::monitoring_frame::AdditionalFieldMissing& e)
@@ -254,19 +299,36 @@ ScannerProtocolDef::checkForChangedActiveZoneset(const data_conversion_layer::mo
 }
 
 inline void ScannerProtocolDef::informUserAboutTheScanData(
-    const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg)
+    data_conversion_layer::monitoring_frame::MessageStamped&& stamped_msg)
 {
-  try
+  auto& scan_buffer{ scan_buffers_.at(stamped_msg.msg_.scannerId()) };
+  if (partialScansActive())
   {
-    scan_buffers_.at(stamped_msg.msg_.scannerId()).add(stamped_msg);
-    if (!config_.fragmentedScansEnabled() && scan_buffers_.at(stamped_msg.msg_.scannerId()).isRoundComplete())
-    {
-      sendMessageWithMeasurements(scan_buffers_.at(stamped_msg.msg_.scannerId()).currentRound());
-    }
+    sendOverdueRoundsAsPartialScans(scan_buffer, stamped_msg);
   }
-  catch (const ScanRoundError& ex)
+  // The fragment is still needed after validating it, otherwise it is moved into the buffer.
+  const ScanBufferStatus status{ config_.fragmentedScansEnabled() ? scan_buffer.tryAdd(stamped_msg) :
+                                                                    scan_buffer.tryAdd(std::move(stamped_msg)) };
+  switch (status)
   {
-    PSENSCAN_WARN("ScanBuffer", ex.what());
+    case ScanBufferStatus::outdated:
+      ++monitoring_frame_statistics_.outdated_frames;
+      PSENSCAN_WARN("ScanBuffer", OUTDATED_MESSAGE_ERROR_MSG);
+      break;
+    case ScanBufferStatus::round_ended_early:
+      ++monitoring_frame_statistics_.rounds_ended_early;
+      PSENSCAN_WARN("ScanBuffer", SCAN_ROUND_ENDED_EARLY_ERROR_MSG);
+      break;
+    case ScanBufferStatus::oversaturated:
+      ++monitoring_frame_statistics_.oversaturated_rounds;
+      PSENSCAN_WARN("ScanBuffer", SCAN_ROUND_OVERSATURATED_ERROR_MSG);
+      break;
+    default:
+      if (!config_.fragmentedScansEnabled() && scan_buffer.isRoundComplete())
+      {
+        sendMessageWithMeasurements(scan_buffer.takeRound());
+      }
+      break;
   }
   if (config_.fragmentedScansEnabled())  // Send the scan fragment in any case.
   {
@@ -279,16 +341,61 @@ inline void ScannerProtocolDef::sendMessageWithMeasurements(
 {
   if (framesContainMeasurements(stamped_msgs))
   {
-    try
+    boost::optional<LaserScan> scan;
+    const data_conversion_layer::ScanConversionStatus status{
+      data_conversion_layer::LaserScanConverter::tryToLaserScan(stamped_msgs, scan)
+    };
+    if (status != data_conversion_layer::ScanConversionStatus::ok)
     {
-      inform_user_about_laser_scan_callback_(data_conversion_layer::LaserScanConverter::toLaserScan(stamped_msgs));
+      ++monitoring_frame_statistics_.rejected_scans;
+      PSENSCAN_ERROR("StateMachine", data_conversion_layer::toString(status));
+      return;
     }
-    // LCOV_EXCL_START
-    catch (const data_conversion_layer::ScannerProtocolViolationError& ex)
+    if (partialScansActive())
     {
-      PSENSCAN_ERROR("StateMachine", ex.what());
+      complete_scan_angles_[scan->scannerId()] = { scan->minScanAngle(), scan->maxScanAngle() };
     }
-    // LCOV_EXCL_STOP
+    inform_user_about_laser_scan_callback_(std::move(scan.get()));
+  }
+}
+
+inline bool ScannerProtocolDef::partialScansActive() const
+{
+  return config_.partialScansEnabled() && !config_.fragmentedScansEnabled();
+}
+
+inline void ScannerProtocolDef::sendOverdueRoundsAsPartialScans(
+    ScanBuffer& scan_buffer, const data_conversion_layer::monitoring_frame::MessageStamped& next_msg)
+{
+  // The deadline is checked on arrival of the next frame. So a round whose last frames are lost is passed on at the
+  // latest with the first frame of the following round.
+  while (const auto* stamped_msgs = scan_buffer.takeOverdueRound(next_msg, SCAN_ROUND_DEADLINE.count()))
+  {
+    if (!framesContainMeasurements(*stamped_msgs))
+    {
+      continue;
+    }
+    const auto angles{ complete_scan_angles_.find(next_msg.msg_.scannerId()) };
+    boost::optional<LaserScan> scan;
+    const data_conversion_layer::ScanConversionStatus status{
+      data_conversion_layer::LaserScanConverter::tryToPartialLaserScan(
+          *stamped_msgs,
+          angles != complete_scan_angles_.end() ? boost::make_optional(angles->second) : boost::none,
+          scan)
+    };
+    if (status != data_conversion_layer::ScanConversionStatus::ok)
+    {
+      ++monitoring_frame_statistics_.rejected_scans;
+      PSENSCAN_ERROR("StateMachine", data_conversion_layer::toString(status));
+      continue;
+    }
+    ++monitoring_frame_statistics_.partial_scans;
+    PSENSCAN_WARN_THROTTLE(1 /* sec */,
+                           "StateMachine",
+                           "Passing on incomplete scan round {} with {} missing measurements.",
+                           scan->scanCounter(),
+                           scan->numberOfMissingMeasurements());
+    inform_user_about_laser_scan_callback_(std::move(scan.get()));
   }
 }
 
@@ -296,7 +403,7 @@ inline bool ScannerProtocolDef::framesContainMeasurements(
     const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs)
 {
   if (std::all_of(stamped_msgs.begin(), stamped_msgs.end(), [](const auto& stamped_msg) {
-        return stamped_msg.msg_.measurements().empty();
+        return stamped_msg.msg_.numberOfMeasurements() == 0;
       }))
   {
     PSENSCAN_DEBUG("StateMachine", "No measurement data in current monitoring frame(s), skipping laser scan callback.");
@@ -433,6 +540,16 @@ static std::string classNameShort(const T& t)
   return full_name.substr(full_name.rfind("::") + 2);
 }
 
+inline const MonitoringFrameStatistics& ScannerProtocolDef::monitoringFrameStatistics() const
+{
+  return monitoring_frame_statistics_;
+}
+
+inline communication_layer::ReceiveStatistics ScannerProtocolDef::dataReceiveStatistics() const
+{
+  return data_client_.receiveStatistics();
+}
+
 // LCOV_EXCL_START
 template <class FSM, class Event>
 void ScannerProtocolDef::exception_caught(Event const& event, FSM& /*unused*/, std::exception& exception)  // NOLINT
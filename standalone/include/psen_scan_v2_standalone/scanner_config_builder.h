@@ -21,9 +21,11 @@
 #include <string>
 
 #include "psen_scan_v2_standalone/scanner_configuration.h"
+#include "psen_scan_v2_standalone/configuration/default_parameters.h"
 #include "psen_scan_v2_standalone/configuration/scanner_ids.h"
 #include "psen_scan_v2_standalone/scan_range.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/angle_conversions.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
 #include "psen_scan_v2_standalone/util/ip_conversion.h"
 
 namespace psen_scan_v2_standalone
@@ -50,7 +52,108 @@ public:
   ScannerConfigurationBuilder& enableDiagnostics(const bool& enable);
   ScannerConfigurationBuilder& enableIntensities(const bool& enable);
   ScannerConfigurationBuilder& enableFragmentedScans(const bool& enable);
+  /**
+   * @brief Processes measurements and intensities as float instead of double.
+   *
+   * The resulting LaserScan provides its data via LaserScan::singlePrecisionMeasurements() and
+   * LaserScan::singlePrecisionIntensities().
+   */
+  ScannerConfigurationBuilder& enableSinglePrecision(const bool& enable);
+  /**
+   * @brief Passes measurements (in mm) and intensities through as the raw uint16 samples sent by the scanner.
+   *
+   * The resulting LaserScan provides its data via LaserScan::rawMeasurements() and LaserScan::rawIntensities().
+   * Takes precedence over enableSinglePrecision().
+   */
+  ScannerConfigurationBuilder& enableRawSamples(const bool& enable);
+  /**
+   * @brief Drains all monitoring frames waiting in the socket with one syscall instead of receiving them one by one.
+   *
+   * Reduces the load of the receiving thread if the scanner sends its frames in bursts. Only available on Linux.
+   *
+   * @see communication_layer::ReceiveMode::continuous_batched
+   */
+  ScannerConfigurationBuilder& enableBatchedReceive(const bool& enable);
+  /**
+   * @brief Receives the monitoring frames via io_uring instead of one syscall per frame.
+   *
+   * The frames are received into buffers registered with the kernel by a single multishot receive. Requires Linux 6.0,
+   * otherwise the frames are received in batches. Takes precedence over enableBatchedReceive().
+   *
+   * @see communication_layer::ReceiveMode::continuous_io_uring
+   */
+  ScannerConfigurationBuilder& enableIoUringReceive(const bool& enable);
+  /**
+   * @brief Stamps the monitoring frames with their arrival time in the kernel instead of the time they are processed.
+   *
+   * The timestamp of the LaserScan is then not affected by the scheduling of the receiving thread. Only available on
+   * Linux, on other platforms the time of processing is used.
+   *
+   * @see communication_layer::UdpClientImpl::enableKernelTimestamps()
+   */
+  ScannerConfigurationBuilder& enableKernelTimestamps(const bool& enable);
+  /**
+   * @brief Keeps incomplete scan rounds open while the given number of newer rounds start.
+   *
+   * Monitoring frames which arrive out of order, for example on switched networks with several scanners, still
+   * complete their round instead of dropping it. Only incomplete rounds are delayed, by at most number_of_rounds scan
+   * rounds. The default of 0 drops an incomplete round as soon as the next one starts.
+   *
+   * @throws std::invalid_argument if number_of_rounds exceeds configuration::MAX_SCAN_ROUND_REORDER_WINDOW.
+   */
+  ScannerConfigurationBuilder& scanRoundReorderWindow(const uint32_t& number_of_rounds);
+  /**
+   * @brief Passes incomplete scan rounds on as partial scans instead of dropping them.
+   *
+   * A scan round is passed on once the time of a full scan has passed since its first monitoring frame arrived, or
+   * once it would fall out of the reorder window. The measurements of the missing frames are filled in and counted by
+   * LaserScan::numberOfMissingMeasurements(). Has no effect if fragmented scans are enabled.
+   *
+   * @note The deadline is checked on arrival of the next monitoring frame. An incomplete round is not passed on as long
+   * as no further frame arrives.
+   *
+   * @see data_conversion_layer::LaserScanConverter::tryToPartialLaserScan()
+   */
+  ScannerConfigurationBuilder& enablePartialScans(const bool& enable);
+  /**
+   * @brief Sets options of the socket receiving the monitoring frames, like the size of the receive buffer.
+   *
+   * The values applied by the kernel are logged. Only available on Linux.
+   */
+  ScannerConfigurationBuilder& dataSocketOptions(const communication_layer::SocketOptions& options);
+  /**
+   * @brief Sets options of the socket sending the start and stop requests, like the priority of the requests.
+   *
+   * @see dataSocketOptions()
+   */
+  ScannerConfigurationBuilder& controlSocketOptions(const communication_layer::SocketOptions& options);
+  /**
+   * @brief Sets the CPU affinity and real-time scheduling of the threads receiving and processing the data.
+   *
+   * Real-time scheduling requires CAP_SYS_NICE, without it the threads keep the default scheduling and a warning is
+   * logged. Only available on Linux and if the scanner does not use a shared io_service.
+   *
+   * @see communication_layer::UdpClientImpl::applyThreadScheduling()
+   */
+  ScannerConfigurationBuilder& networkThreadScheduling(const util::ThreadScheduling& scheduling);
+  /**
+   * @brief Overrides the size of the buffers the monitoring frames are received into.
+   *
+   * By default the size is derived from the scan resolution and the intensity settings. Larger frames are reported as
+   * error and dropped.
+   *
+   * @throws std::invalid_argument if max_frame_size is 0 or exceeds the maximal size of an UDP datagram.
+   */
+  ScannerConfigurationBuilder& maxFrameSize(const std::size_t& max_frame_size);
   ScannerConfigurationBuilder& nrSubscribers(const uint8_t& nr_subscribers);
+  /**
+   * @brief Selects the additional fields of the monitoring frames which are decoded.
+   *
+   * Fields the application never reads can be skipped to save CPU time and allocations. The scan counter, the active
+   * zoneset and the measurements are needed to build a LaserScan and are therefore always decoded.
+   */
+  ScannerConfigurationBuilder&
+  decodeOptions(const data_conversion_layer::monitoring_frame::DecodeOptions& decode_options);
   operator ScannerConfiguration();
 
 private:
@@ -153,6 +256,85 @@ inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::enableFragmente
   return *this;
 }
 
+inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::enableSinglePrecision(const bool& enable = true)
+{
+  config_.single_precision_ = enable;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::enableRawSamples(const bool& enable = true)
+{
+  config_.raw_samples_ = enable;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::enableBatchedReceive(const bool& enable = true)
+{
+  config_.batched_receive_ = enable;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::enableIoUringReceive(const bool& enable = true)
+{
+  config_.io_uring_receive_ = enable;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::enableKernelTimestamps(const bool& enable = true)
+{
+  config_.kernel_timestamps_ = enable;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder&
+ScannerConfigurationBuilder::scanRoundReorderWindow(const uint32_t& number_of_rounds)
+{
+  if (number_of_rounds > configuration::MAX_SCAN_ROUND_REORDER_WINDOW)
+  {
+    throw std::invalid_argument("The scan round reorder window must not exceed " +
+                                std::to_string(configuration::MAX_SCAN_ROUND_REORDER_WINDOW) + " rounds.");
+  }
+  config_.scan_round_reorder_window_ = number_of_rounds;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::enablePartialScans(const bool& enable = true)
+{
+  config_.partial_scans_ = enable;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder&
+ScannerConfigurationBuilder::dataSocketOptions(const communication_layer::SocketOptions& options)
+{
+  config_.data_socket_options_ = options;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder&
+ScannerConfigurationBuilder::controlSocketOptions(const communication_layer::SocketOptions& options)
+{
+  config_.control_socket_options_ = options;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder&
+ScannerConfigurationBuilder::networkThreadScheduling(const util::ThreadScheduling& scheduling)
+{
+  config_.network_thread_scheduling_ = scheduling;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::maxFrameSize(const std::size_t& max_frame_size)
+{
+  if (max_frame_size == 0 || max_frame_size > data_conversion_layer::MAX_UDP_PAKET_SIZE)
+  {
+    throw std::invalid_argument("Maximal frame size has to be between 1 and 65507 bytes.");
+  }
+  config_.max_frame_size_ = max_frame_size;
+  return *this;
+}
+
 inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::nrSubscribers(const uint8_t& nr_subscribers = 0)
 {
   if (nr_subscribers > configuration::MAX_NR_SUBSCRIBERS)
@@ -163,6 +345,16 @@ inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::nrSubscribers(c
   return *this;
 }
 
+inline ScannerConfigurationBuilder&
+ScannerConfigurationBuilder::decodeOptions(const data_conversion_layer::monitoring_frame::DecodeOptions& decode_options)
+{
+  using data_conversion_layer::monitoring_frame::DecodeField;
+  config_.decode_options_ = decode_options.with(DecodeField::scan_counter)
+                                .with(DecodeField::zoneset)
+                                .with(DecodeField::measurements);
+  return *this;
+}
+
 ScannerConfigurationBuilder::operator ScannerConfiguration()
 {
   return build();
@@ -15,9 +15,14 @@
 #ifndef PSEN_SCAN_V2_STANDALONE_SCANNER_CONFIGURATION_H
 #define PSEN_SCAN_V2_STANDALONE_SCANNER_CONFIGURATION_H
 
+#include <cstddef>
+
 #include <boost/optional.hpp>
 
+#include "psen_scan_v2_standalone/communication_layer/socket_options.h"
+#include "psen_scan_v2_standalone/util/thread_scheduling.h"
 #include "psen_scan_v2_standalone/configuration/default_parameters.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_decode_options.h"
 #include "psen_scan_v2_standalone/util/logging.h"
 #include "psen_scan_v2_standalone/scan_range.h"
 
@@ -54,6 +59,49 @@ public:
   bool fragmentedScansEnabled() const;
   uint8_t nrSubscribers() const;
 
+  //! @brief Returns true if measurements and intensities are processed as float instead of double.
+  bool singlePrecisionEnabled() const;
+  //! @brief Returns true if measurements and intensities are passed through as raw uint16 samples.
+  bool rawSamplesEnabled() const;
+
+  //! @brief Returns true if the monitoring frames are received in batches.
+  //! @see communication_layer::ReceiveMode::continuous_batched
+  bool batchedReceiveEnabled() const;
+  //! @brief Returns true if the monitoring frames are received via io_uring.
+  //! @see communication_layer::ReceiveMode::continuous_io_uring
+  bool ioUringReceiveEnabled() const;
+
+  //! @brief Returns true if the monitoring frames are stamped with their arrival time in the kernel.
+  bool kernelTimestampsEnabled() const;
+
+  //! @brief Returns the number of rounds preceding the newest one which still accept monitoring frames.
+  //! @see protocol_layer::ScanBuffer
+  uint32_t scanRoundReorderWindow() const;
+
+  //! @brief Returns true if incomplete scan rounds are passed on as partial scans once their deadline passed.
+  //! @see ScannerConfigurationBuilder::enablePartialScans()
+  bool partialScansEnabled() const;
+
+  //! @brief Returns the options applied to the socket receiving the monitoring frames.
+  const communication_layer::SocketOptions& dataSocketOptions() const;
+  //! @brief Returns the options applied to the socket sending the start and stop requests.
+  const communication_layer::SocketOptions& controlSocketOptions() const;
+  //! @brief Returns the CPU affinity and real-time scheduling of the threads receiving and processing the data.
+  const util::ThreadScheduling& networkThreadScheduling() const;
+
+  /**
+   * @brief Returns the size of the buffers the monitoring frames are received into.
+   *
+   * Unless set explicitly, this is the largest frame the scanner sends with the configured resolution and intensity
+   * settings.
+   *
+   * @see data_conversion_layer::monitoring_frame::maxFrameSize()
+   */
+  std::size_t maxFrameSize() const;
+
+  //! @brief Returns which additional fields of the monitoring frames are decoded by the driver and in which precision.
+  data_conversion_layer::monitoring_frame::DecodeOptions decodeOptions() const;
+
   /*! deprecated: use void hostIp(const uint32_t& host_ip) instead */
   [[deprecated("use void hostIp(const uint32_t& host_ip) instead")]] void setHostIp(const uint32_t& host_ip);
   void hostIp(const uint32_t& host_ip);
@@ -81,6 +129,18 @@ private:
   bool intensities_enabled_{ configuration::INTENSITIES };
   bool fragmented_scans_{ configuration::FRAGMENTED_SCANS };
   uint8_t nr_subscribers_{ configuration::NR_SUBSCRIBERS };
+  data_conversion_layer::monitoring_frame::DecodeOptions decode_options_{};
+  bool single_precision_{ false };
+  bool raw_samples_{ false };
+  bool batched_receive_{ false };
+  bool io_uring_receive_{ false };
+  bool kernel_timestamps_{ false };
+  uint32_t scan_round_reorder_window_{ 0 };
+  bool partial_scans_{ false };
+  communication_layer::SocketOptions data_socket_options_;
+  communication_layer::SocketOptions control_socket_options_;
+  util::ThreadScheduling network_thread_scheduling_;
+  boost::optional<std::size_t> max_frame_size_;
 };
 
 inline bool ScannerConfiguration::isComplete() const
@@ -158,6 +218,61 @@ inline uint8_t ScannerConfiguration::nrSubscribers() const
   return nr_subscribers_;
 }
 
+inline bool ScannerConfiguration::singlePrecisionEnabled() const
+{
+  return single_precision_;
+}
+
+inline bool ScannerConfiguration::rawSamplesEnabled() const
+{
+  return raw_samples_;
+}
+
+inline bool ScannerConfiguration::batchedReceiveEnabled() const
+{
+  return batched_receive_;
+}
+
+inline bool ScannerConfiguration::ioUringReceiveEnabled() const
+{
+  return io_uring_receive_;
+}
+
+inline bool ScannerConfiguration::kernelTimestampsEnabled() const
+{
+  return kernel_timestamps_;
+}
+
+inline uint32_t ScannerConfiguration::scanRoundReorderWindow() const
+{
+  return scan_round_reorder_window_;
+}
+
+inline bool ScannerConfiguration::partialScansEnabled() const
+{
+  return partial_scans_;
+}
+
+inline const communication_layer::SocketOptions& ScannerConfiguration::dataSocketOptions() const
+{
+  return data_socket_options_;
+}
+
+inline const communication_layer::SocketOptions& ScannerConfiguration::controlSocketOptions() const
+{
+  return control_socket_options_;
+}
+
+inline const util::ThreadScheduling& ScannerConfiguration::networkThreadScheduling() const
+{
+  return network_thread_scheduling_;
+}
+
+inline data_conversion_layer::monitoring_frame::DecodeOptions ScannerConfiguration::decodeOptions() const
+{
+  return decode_options_.withSinglePrecision(single_precision_).withRawSamples(raw_samples_);
+}
+
 inline void ScannerConfiguration::hostIp(const uint32_t& host_ip)
 {
   host_ip_ = host_ip;
@@ -30,7 +30,7 @@ namespace psen_scan_v2_standalone
  *
  * This interface allows to:
  * - Set a configuration for the scanner on startup
- * - Define a callback for incoming scans
+ * - Define a callback for incoming scans, which either receives a reference to each scan or shares its ownership
  * - Start and stop the communication with the scanner
  *
  * @see protocol_layer::LaserScanCallback
@@ -42,9 +42,16 @@ class IScanner
 public:
   //! @brief Represents the user-provided callback for processing incoming scan data.
   using LaserScanCallback = std::function<void(const LaserScan&)>;
+  /**
+   * @brief Alternative callback, which shares the ownership of each incoming scan with the user.
+   *
+   * The scan can be retained, e.g. by several consumers, without copying it.
+   */
+  using SharedLaserScanCallback = std::function<void(const LaserScanConstPtr&)>;
 
 public:
   IScanner(const ScannerConfiguration& scanner_config, const LaserScanCallback& laser_scan_callback);
+  IScanner(const ScannerConfiguration& scanner_config, const SharedLaserScanCallback& laser_scan_callback);
   virtual ~IScanner() = default;
 
 public:
@@ -63,10 +70,13 @@ protected:
   [[deprecated("use const LaserScanCallback& laserScanCallback() const instead")]] const LaserScanCallback&
   getLaserScanCallback() const;
   const LaserScanCallback& laserScanCallback() const;
+  //! @brief Returns the callback sharing the ownership of the scans, which is empty if a LaserScanCallback was passed.
+  const SharedLaserScanCallback& sharedLaserScanCallback() const;
 
 private:
   const ScannerConfiguration config_;
   const LaserScanCallback laser_scan_callback_;
+  const SharedLaserScanCallback shared_laser_scan_callback_;
 };
 
 inline IScanner::IScanner(const ScannerConfiguration& scanner_config, const LaserScanCallback& laser_scan_callback)
@@ -78,6 +88,16 @@ inline IScanner::IScanner(const ScannerConfiguration& scanner_config, const Lase
   }
 }
 
+inline IScanner::IScanner(const ScannerConfiguration& scanner_config,
+                          const SharedLaserScanCallback& laser_scan_callback)
+  : config_(scanner_config), shared_laser_scan_callback_(laser_scan_callback)
+{
+  if (!laser_scan_callback)
+  {
+    throw std::invalid_argument("Laserscan-callback must not be null");
+  }
+}
+
 inline const ScannerConfiguration& IScanner::config() const
 {
   return config_;
@@ -88,6 +108,11 @@ inline const IScanner::LaserScanCallback& IScanner::laserScanCallback() const
   return laser_scan_callback_;
 }
 
+inline const IScanner::SharedLaserScanCallback& IScanner::sharedLaserScanCallback() const
+{
+  return shared_laser_scan_callback_;
+}
+
 inline const ScannerConfiguration& IScanner::getConfig() const
 {
   return this->config();
@@ -17,12 +17,14 @@
 
 #include <memory>
 #include <mutex>
+#include <cstddef>
 #include <future>
 #include <functional>
 
 #include <boost/optional.hpp>
 
 #include "psen_scan_v2_standalone/scanner_interface.h"
+#include "psen_scan_v2_standalone/communication_layer/io_service_thread_pool.h"
 #include "psen_scan_v2_standalone/protocol_layer/scanner_events.h"
 #include "psen_scan_v2_standalone/protocol_layer/scanner_state_machine.h"
 
@@ -61,6 +63,22 @@ class ScannerV2 : public IScanner
 {
 public:
   ScannerV2(const ScannerConfiguration& scanner_config, const LaserScanCallback& laser_scan_callback);
+  //! @brief Passes each scan to the callback without copying it, see IScanner::SharedLaserScanCallback.
+  ScannerV2(const ScannerConfiguration& scanner_config, const SharedLaserScanCallback& laser_scan_callback);
+  //! @throws std::invalid_argument like a null callback, the overload only resolves the ambiguity of nullptr.
+  ScannerV2(const ScannerConfiguration& scanner_config, std::nullptr_t laser_scan_callback);
+  /**
+   * @brief Runs the network communication on the given io_service instead of dedicated threads.
+   *
+   * This allows several scanners to share a fixed number of threads, see communication_layer::IoServiceThreadPool.
+   * The io_service has to be run until the scanner is destroyed.
+   */
+  ScannerV2(const ScannerConfiguration& scanner_config,
+            const LaserScanCallback& laser_scan_callback,
+            boost::asio::io_service& io_service);
+  ScannerV2(const ScannerConfiguration& scanner_config,
+            const SharedLaserScanCallback& laser_scan_callback,
+            boost::asio::io_service& io_service);
   ~ScannerV2() override;
 
 public:
@@ -70,7 +88,23 @@ public:
   //! @brief An exception is set in the returned future if the scanner stop was not successful.
   std::future<void> stop() override;
 
+  /**
+   * @brief Returns the counters of the monitoring frames received on the data socket.
+   *
+   * Datagrams dropped by the kernel (ReceiveStatistics::kernel_drops) indicate that the host cannot keep up with the
+   * scanner, whereas frames lost on the network only show up in monitoringFrameStatistics().
+   */
+  communication_layer::ReceiveStatistics receiveStatistics();
+
+  //! @brief Returns the counters of the monitoring frames and scan rounds which could not be passed to the user.
+  MonitoringFrameStatistics monitoringFrameStatistics();
+
 private:
+  template <typename Callback>
+  ScannerV2(const ScannerConfiguration& scanner_config,
+            const Callback& laser_scan_callback,
+            boost::asio::io_service* io_service);
+
   template <class T>
   void triggerEventWithParam(const T& event);
 
@@ -81,6 +115,8 @@ private:
   void scannerStoppedCallback();
   void scannerStartErrorCallback(const std::string& error_msg);
   void scannerStopErrorCallback(const std::string& error_msg);
+  //! @brief Passes the scan to the callback of the user, sharing its ownership if requested.
+  void informUserAboutLaserScan(LaserScan&& scan);
 
 private:
   using OptionalPromise = boost::optional<std::promise<void>>;
@@ -0,0 +1,230 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_THREAD_SCHEDULING_H
+#define PSEN_SCAN_V2_STANDALONE_THREAD_SCHEDULING_H
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+#include <boost/optional.hpp>
+
+#include "psen_scan_v2_standalone/util/format_range.h"
+#include "psen_scan_v2_standalone/util/logging.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace util
+{
+/**
+ * @brief Real-time scheduling policies which can be assigned to a thread.
+ */
+enum class SchedulingPolicy
+{
+  //! @brief SCHED_FIFO: Runs until it blocks or a thread with higher priority becomes ready.
+  fifo,
+  //! @brief SCHED_RR: Like fifo, but threads with the same priority take turns.
+  round_robin
+};
+
+/**
+ * @brief CPU affinity and real-time scheduling of a thread.
+ *
+ * Settings which are not set keep the defaults of the operating system. If a setting cannot be applied, for example
+ * because the process lacks CAP_SYS_NICE, the thread keeps its previous setting.
+ *
+ * @note The settings are only supported on Linux.
+ * @see applyThreadScheduling()
+ */
+class ThreadScheduling
+{
+public:
+  /**
+   * @brief Restricts the thread to the given CPUs.
+   *
+   * @throws std::invalid_argument if cpus is empty or contains a CPU greater than MAX_CPU.
+   */
+  ThreadScheduling& cpuAffinity(const std::vector<unsigned int>& cpus);
+  /**
+   * @brief Runs the thread with a real-time scheduling policy, so it is not preempted by normal threads.
+   *
+   * @throws std::invalid_argument if priority is not between MIN_PRIORITY and MAX_PRIORITY.
+   */
+  ThreadScheduling& realtime(const SchedulingPolicy& policy, const int& priority);
+
+  const boost::optional<std::vector<unsigned int>>& cpuAffinity() const;
+  const boost::optional<SchedulingPolicy>& policy() const;
+  const boost::optional<int>& priority() const;
+
+  bool operator==(const ThreadScheduling& rhs) const;
+  bool operator!=(const ThreadScheduling& rhs) const;
+
+public:
+  static constexpr unsigned int MAX_CPU{ 1023 };
+  static constexpr int MIN_PRIORITY{ 1 };
+  static constexpr int MAX_PRIORITY{ 99 };
+
+private:
+  boost::optional<std::vector<unsigned int>> cpu_affinity_;
+  boost::optional<SchedulingPolicy> policy_;
+  boost::optional<int> priority_;
+};
+
+/**
+ * @brief Applies the scheduling to the thread and logs the result.
+ *
+ * @param thread_name Name of the thread used in the log messages.
+ * @returns false if any of the settings could not be applied. The thread keeps its previous setting in this case.
+ */
+bool applyThreadScheduling(std::thread& thread, const ThreadScheduling& scheduling, const std::string& thread_name);
+
+inline ThreadScheduling& ThreadScheduling::cpuAffinity(const std::vector<unsigned int>& cpus)
+{
+  if (cpus.empty())
+  {
+    throw std::invalid_argument("CPU affinity needs at least one CPU.");
+  }
+  for (const auto& cpu : cpus)
+  {
+    if (cpu > MAX_CPU)
+    {
+      throw std::invalid_argument("CPU " + std::to_string(cpu) + " exceeds the maximal CPU 1023.");
+    }
+  }
+  cpu_affinity_ = cpus;
+  return *this;
+}
+
+inline ThreadScheduling& ThreadScheduling::realtime(const SchedulingPolicy& policy, const int& priority)
+{
+  if (priority < MIN_PRIORITY || priority > MAX_PRIORITY)
+  {
+    throw std::invalid_argument("Real-time priority has to be between 1 and 99.");
+  }
+  policy_ = policy;
+  priority_ = priority;
+  return *this;
+}
+
+inline const boost::optional<std::vector<unsigned int>>& ThreadScheduling::cpuAffinity() const
+{
+  return cpu_affinity_;
+}
+
+inline const boost::optional<SchedulingPolicy>& ThreadScheduling::policy() const
+{
+  return policy_;
+}
+
+inline const boost::optional<int>& ThreadScheduling::priority() const
+{
+  return priority_;
+}
+
+inline bool ThreadScheduling::operator==(const ThreadScheduling& rhs) const
+{
+  return cpu_affinity_ == rhs.cpu_affinity_ && policy_ == rhs.policy_ && priority_ == rhs.priority_;
+}
+
+inline bool ThreadScheduling::operator!=(const ThreadScheduling& rhs) const
+{
+  return !(*this == rhs);
+}
+
+inline bool
+applyThreadScheduling(std::thread& thread, const ThreadScheduling& scheduling, const std::string& thread_name)
+{
+  bool success{ true };
+#ifdef __linux__
+  if (scheduling.cpuAffinity())
+  {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const auto& cpu : *scheduling.cpuAffinity())
+    {
+      CPU_SET(cpu, &cpu_set);
+    }
+    const int result{ ::pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set), &cpu_set) };
+    if (result != 0)
+    {
+      PSENSCAN_WARN("ThreadScheduling",
+                    "Could not pin {} thread to CPUs {}: {}",
+                    thread_name,
+                    util::formatRange(*scheduling.cpuAffinity()),
+                    std::strerror(result));
+      success = false;
+    }
+    else
+    {
+      PSENSCAN_INFO("ThreadScheduling",
+                    "Pinned {} thread to CPUs {}.",
+                    thread_name,
+                    util::formatRange(*scheduling.cpuAffinity()));
+    }
+  }
+  if (scheduling.policy())
+  {
+    const bool fifo{ *scheduling.policy() == SchedulingPolicy::fifo };
+    sched_param param{};
+    param.sched_priority = *scheduling.priority();
+    const int result{ ::pthread_setschedparam(thread.native_handle(), fifo ? SCHED_FIFO : SCHED_RR, &param) };
+    if (result == EPERM)
+    {
+      PSENSCAN_WARN("ThreadScheduling",
+                    "Missing permission (CAP_SYS_NICE or RLIMIT_RTPRIO) for real-time scheduling of {} thread, it "
+                    "keeps the default scheduling.",
+                    thread_name);
+      success = false;
+    }
+    else if (result != 0)
+    {
+      PSENSCAN_WARN("ThreadScheduling",
+                    "Could not set real-time scheduling of {} thread, it keeps the default scheduling: {}",
+                    thread_name,
+                    std::strerror(result));
+      success = false;
+    }
+    else
+    {
+      PSENSCAN_INFO("ThreadScheduling",
+                    "{} thread runs with {} priority {}.",
+                    thread_name,
+                    fifo ? "SCHED_FIFO" : "SCHED_RR",
+                    *scheduling.priority());
+    }
+  }
+#else
+  if (scheduling != ThreadScheduling())
+  {
+    PSENSCAN_WARN("ThreadScheduling", "Thread scheduling is only supported on Linux.");
+    success = false;
+  }
+#endif
+  return success;
+}
+
+}  // namespace util
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_THREAD_SCHEDULING_H
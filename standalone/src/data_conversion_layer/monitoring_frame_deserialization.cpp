@@ -13,10 +13,11 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+#include <algorithm>
 #include <array>
-#include <functional>
 #include <istream>
-#include <sstream>
+#include <limits>
+#include <string>
 #include <vector>
 
 #include <fmt/format.h>
@@ -24,8 +25,10 @@
 #include "psen_scan_v2_standalone/data_conversion_layer/diagnostics.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_field_descriptors.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg_builder.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_sample_conversion.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/raw_processing.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
 #include "psen_scan_v2_standalone/io_state.h"
@@ -37,8 +40,6 @@ namespace data_conversion_layer
 {
 namespace monitoring_frame
 {
-using namespace std::placeholders;
-
 AdditionalFieldHeader::AdditionalFieldHeader(Id id, Length length) : id_(id), length_(length)
 {
 }
@@ -60,109 +61,395 @@ FixedFields::FixedFields(DeviceStatus device_status,
 {
 }
 
-static constexpr double toMeter(const uint16_t& value)
+static constexpr std::size_t NUMBER_OF_BYTES_FIXED_FIELDS{ sizeof(FixedFields::DeviceStatus) +
+                                                           sizeof(FixedFields::OpCode) +
+                                                           sizeof(FixedFields::WorkingMode) +
+                                                           sizeof(FixedFields::TransactionType) +
+                                                           sizeof(configuration::ScannerId) + 2 * sizeof(int16_t) };
+static constexpr std::size_t NUMBER_OF_BYTES_ADDITIONAL_FIELD_HEADER{ sizeof(AdditionalFieldHeader::Id) +
+                                                                     sizeof(AdditionalFieldHeader::Length) };
+//! The end of frame id is followed by three bytes without specified content.
+static constexpr std::size_t NUMBER_OF_BYTES_END_OF_FRAME{ sizeof(AdditionalFieldHeader::Id) + 3 };
+//! Angle covered by a complete scan, the measurements of a frame never exceed it.
+static constexpr util::TenthOfDegree MAX_SCAN_ANGLE{ 2750 };
+
+/**
+ * @brief Details about a malformed frame, only evaluated to create the message of the exceptions thrown by
+ * deserialize() and readAdditionalField().
+ */
+struct DecodingError
+{
+  AdditionalFieldHeader::Id field_id{ 0 };
+  std::size_t length{ 0 };
+  std::size_t expected_length{ 0 };
+  std::size_t position{ 0 };
+};
+
+namespace field_decoder
+{
+void decodeIOPinData(raw_processing::RawDataReader& payload,
+                     const DecodeOptions& /*options*/,
+                     MessageBuilder& msg_builder)
+{
+  msg_builder.iOPinData(io::deserializePins(payload));
+}
+
+void decodeScanCounter(raw_processing::RawDataReader& payload,
+                       const DecodeOptions& /*options*/,
+                       MessageBuilder& msg_builder)
+{
+  msg_builder.scanCounter(raw_processing::read<uint32_t>(payload));
+}
+
+void decodeZoneset(raw_processing::RawDataReader& payload,
+                   const DecodeOptions& /*options*/,
+                   MessageBuilder& msg_builder)
+{
+  msg_builder.activeZoneset(raw_processing::read<uint8_t>(payload));
+}
+
+void decodeDiagnostics(raw_processing::RawDataReader& payload,
+                       const DecodeOptions& /*options*/,
+                       MessageBuilder& msg_builder)
+{
+  msg_builder.diagnosticMessages(diagnostic::deserializeMessages(payload));
+}
+
+void decodeMeasurements(raw_processing::RawDataReader& payload,
+                        const DecodeOptions& options,
+                        MessageBuilder& msg_builder)
+{
+  const std::size_t num_measurements{ payload.remaining() / NUMBER_OF_BYTES_SINGLE_MEASUREMENT };
+  if (options.rawSamples())
+  {
+    std::vector<uint16_t> measurements(num_measurements);
+    copyRawSamples(payload.current(), num_measurements, measurements.data());
+    msg_builder.rawMeasurements(measurements);
+  }
+  else if (options.singlePrecision())
+  {
+    std::vector<float> measurements(num_measurements);
+    convertRawMeasurements(payload.current(), num_measurements, measurements.data());
+    msg_builder.singlePrecisionMeasurements(measurements);
+  }
+  else
+  {
+    std::vector<double> measurements(num_measurements);
+    convertRawMeasurements(payload.current(), num_measurements, measurements.data());
+    msg_builder.measurements(measurements);
+  }
+}
+
+void decodeIntensities(raw_processing::RawDataReader& payload,
+                       const DecodeOptions& options,
+                       MessageBuilder& msg_builder)
+{
+  const std::size_t num_intensities{ payload.remaining() / NUMBER_OF_BYTES_SINGLE_INTENSITY };
+  if (options.rawSamples())
+  {
+    // The raw samples still contain the intensity flags, so they are not extracted separately.
+    std::vector<uint16_t> intensities(num_intensities);
+    copyRawSamples(payload.current(), num_intensities, intensities.data());
+    msg_builder.rawIntensities(intensities);
+    return;
+  }
+  std::vector<uint8_t> intensity_flags(numberOfIntensityFlagBytes(num_intensities));
+  if (options.singlePrecision())
+  {
+    std::vector<float> intensities(num_intensities);
+    convertRawIntensities(payload.current(), num_intensities, intensities.data(), intensity_flags.data());
+    msg_builder.singlePrecisionIntensities(intensities);
+  }
+  else
+  {
+    std::vector<double> intensities(num_intensities);
+    convertRawIntensities(payload.current(), num_intensities, intensities.data(), intensity_flags.data());
+    msg_builder.intensities(intensities);
+  }
+  msg_builder.intensityFlags(intensity_flags);
+}
+}  // namespace field_decoder
+
+static std::string fieldName(const AdditionalFieldHeader::Id& id)
+{
+  const FieldDescriptor* descriptor{ fieldDescriptor(id) };
+  return descriptor != nullptr ? descriptor->name : fmt::format("{:#04x}", id);
+}
+
+static DecodingStatus checkFieldSize(const AdditionalFieldHeader& header, const FieldSize& size, DecodingError& error)
 {
-  if ((value == NO_SIGNAL_ARRIVED) || (value == SIGNAL_TOO_LATE))
+  if (!fitsFieldSize(size, header.length()))
   {
-    return std::numeric_limits<double>::infinity();
+    error.expected_length = size.bytes;
+    return DecodingStatus::unexpected_field_size;
   }
-  return static_cast<double>(value) / 1000.;
+  return DecodingStatus::ok;
 }
 
-static constexpr double toIntensities(const uint16_t& value)
+[[noreturn]] static void throwDecodingFailure(const DecodingStatus& status, const DecodingError& error)
 {
-  // Neglegt the first two bytes.
-  uint16_t retval{ value };
-  return static_cast<double>(retval & 0b0011111111111111);
+  switch (status)
+  {
+    case DecodingStatus::unexpected_field_size:
+      throw AdditionalFieldUnexpectedSize(fmt::format("Length of {} field is {}, but should be {}.",
+                                                      fieldName(error.field_id),
+                                                      error.length,
+                                                      error.expected_length));
+    case DecodingStatus::field_length_too_large:
+      throw DecodingFailure(fmt::format(
+          "Length given in header of additional field is too large: {}, id: {:#04x}", error.length, error.field_id));
+    case DecodingStatus::unknown_field_id:
+      throw DecodingFailure(
+          fmt::format("Header Id {:#04x} unknown. Cannot read additional field of monitoring frame on position {}.",
+                      error.field_id,
+                      error.position));
+    default:
+      throw DecodingFailure(fmt::format("Monitoring frame is truncated at position {}.", error.position));
+  }
 }
 
-monitoring_frame::Message deserialize(const data_conversion_layer::RawData& data, const std::size_t& num_bytes)
+static DecodingStatus readAdditionalFieldHeader(raw_processing::RawDataReader& reader,
+                                                const std::size_t& max_num_bytes,
+                                                AdditionalFieldHeader& header,
+                                                DecodingError& error)
 {
-  data_conversion_layer::monitoring_frame::MessageBuilder msg_builder;
+  error.position = reader.position();
+  if (reader.remaining() < NUMBER_OF_BYTES_ADDITIONAL_FIELD_HEADER)
+  {
+    return DecodingStatus::truncated_frame;
+  }
+  error.field_id = raw_processing::read<AdditionalFieldHeader::Id>(reader);
+  error.length = raw_processing::read<AdditionalFieldHeader::Length>(reader);
+  if (error.length >= max_num_bytes)
+  {
+    return DecodingStatus::field_length_too_large;
+  }
+  if (error.length > 0)
+  {
+    error.length--;
+  }
+  if (error.length > reader.remaining())
+  {
+    return DecodingStatus::field_length_too_large;
+  }
+  header = AdditionalFieldHeader(error.field_id, static_cast<AdditionalFieldHeader::Length>(error.length));
+  return DecodingStatus::ok;
+}
 
-  std::stringstream ss;
-  ss.write(data.data(), num_bytes);
+//! @brief State shared by all steps of deserializeInto().
+struct FrameDecodingContext
+{
+  raw_processing::RawDataReader& reader;
+  const std::size_t& num_bytes;
+  const DecodeOptions& options;
+  MessageBuilder& msg_builder;
+  DecodingError& error;
+};
+
+static inline DecodingStatus
+decodeField(const FieldDescriptor& descriptor, const AdditionalFieldHeader& header, FrameDecodingContext& context)
+{
+  const DecodingStatus status{ checkFieldSize(header, descriptor.size, context.error) };
+  if (status != DecodingStatus::ok)
+  {
+    return status;
+  }
+  raw_processing::RawDataReader payload(context.reader.current(), header.length());
+  context.reader.skip(header.length());
+  if (context.options.decodes(descriptor.selection))
+  {
+    descriptor.decode(payload, context.options, context.msg_builder);
+  }
+  return DecodingStatus::ok;
+}
 
-  FixedFields frame_header = readFixedFields(ss);
+//! @brief Sequence of additional fields known at compile time.
+template <AdditionalFieldHeaderID... Ids>
+struct FieldOrder
+{
+};
+
+//! @brief Order in which the scanner sends the additional fields.
+using ScannerFieldOrder = FieldOrder<AdditionalFieldHeaderID::io_pin_data,
+                                     AdditionalFieldHeaderID::scan_counter,
+                                     AdditionalFieldHeaderID::zone_set,
+                                     AdditionalFieldHeaderID::diagnostics,
+                                     AdditionalFieldHeaderID::measurements,
+                                     AdditionalFieldHeaderID::intensities>;
+
+static inline DecodingStatus decodeFieldsInOrder(FieldOrder<> /*order*/,
+                                                 AdditionalFieldHeader& /*header*/,
+                                                 bool& header_pending,
+                                                 FrameDecodingContext& /*context*/)
+{
+  header_pending = false;
+  return DecodingStatus::ok;
+}
+
+/**
+ * @brief Decodes the additional fields as long as the frame follows the given order.
+ *
+ * The descriptor of each field in the order is known at compile time, which allows the compiler to inline the
+ * decoders. At the first field deviating from the order, header_pending is set and the already read header is left
+ * for the generic dispatch in deserializeInto().
+ */
+template <AdditionalFieldHeaderID Id, AdditionalFieldHeaderID... Ids>
+static inline DecodingStatus decodeFieldsInOrder(FieldOrder<Id, Ids...> /*order*/,
+                                                 AdditionalFieldHeader& header,
+                                                 bool& header_pending,
+                                                 FrameDecodingContext& context)
+{
+  DecodingStatus status{ readAdditionalFieldHeader(context.reader, context.num_bytes, header, context.error) };
+  if (status != DecodingStatus::ok)
+  {
+    return status;
+  }
+  if (header.id() != static_cast<AdditionalFieldHeader::Id>(Id))
+  {
+    header_pending = true;
+    return DecodingStatus::ok;
+  }
+  constexpr const FieldDescriptor* descriptor{ fieldDescriptor(static_cast<AdditionalFieldHeader::Id>(Id)) };
+  static_assert(descriptor != nullptr, "Every field of a FieldOrder needs a descriptor.");
+  status = decodeField(*descriptor, header, context);
+  if (status != DecodingStatus::ok)
+  {
+    return status;
+  }
+  return decodeFieldsInOrder(FieldOrder<Ids...>{}, header, header_pending, context);
+}
+
+/**
+ * @brief Common implementation of deserialize() and tryDeserialize().
+ *
+ * All bounds are checked before the data are read, so malformed frames are reported by the returned status and never
+ * by an exception.
+ */
+static DecodingStatus deserializeInto(const data_conversion_layer::RawData& data,
+                                      const std::size_t& num_bytes,
+                                      const DecodeOptions& options,
+                                      MessageBuilder& msg_builder,
+                                      DecodingError& error)
+{
+  raw_processing::RawDataReader reader(data.data(), std::min(num_bytes, data.size()));
+
+  if (reader.remaining() < NUMBER_OF_BYTES_FIXED_FIELDS)
+  {
+    return DecodingStatus::truncated_frame;
+  }
+  FixedFields frame_header = readFixedFields(reader);
 
   msg_builder.scannerId(frame_header.scannerId());
   msg_builder.fromTheta(frame_header.fromTheta());
   msg_builder.resolution(frame_header.resolution());
 
-  bool end_of_frame{ false };
-  while (!end_of_frame)
+  FrameDecodingContext context{ reader, num_bytes, options, msg_builder, error };
+  AdditionalFieldHeader additional_header{ 0, 0 };
+  bool header_pending{ false };
+  DecodingStatus status{ decodeFieldsInOrder(ScannerFieldOrder{}, additional_header, header_pending, context) };
+  if (status != DecodingStatus::ok)
+  {
+    return status;
+  }
+
+  // Generic dispatch for frames deviating from the ScannerFieldOrder and for the end_of_frame marker.
+  while (true)
   {
-    const AdditionalFieldHeader additional_header{ readAdditionalField(ss, num_bytes) };
-    switch (static_cast<AdditionalFieldHeaderID>(additional_header.id()))
+    if (!header_pending)
     {
-      case AdditionalFieldHeaderID::scan_counter:
-        if (additional_header.length() != NUMBER_OF_BYTES_SCAN_COUNTER)
-        {
-          throw AdditionalFieldUnexpectedSize(fmt::format("Length of scan counter field is {}, but should be {}.",
-                                                          additional_header.length(),
-                                                          NUMBER_OF_BYTES_SCAN_COUNTER));
-        }
-        uint32_t scan_counter_read_buffer;
-        raw_processing::read<uint32_t>(ss, scan_counter_read_buffer);
-        msg_builder.scanCounter(scan_counter_read_buffer);
-        break;
-
-      case AdditionalFieldHeaderID::measurements: {
-        const size_t num_measurements{ static_cast<size_t>(additional_header.length()) /
-                                       NUMBER_OF_BYTES_SINGLE_MEASUREMENT };
-        std::vector<double> measurements;
-        raw_processing::readArray<uint16_t, double>(ss, measurements, num_measurements, toMeter);
-        msg_builder.measurements(measurements);
-        break;
+      status = readAdditionalFieldHeader(reader, num_bytes, additional_header, error);
+      if (status != DecodingStatus::ok)
+      {
+        return status;
       }
-      case AdditionalFieldHeaderID::end_of_frame:
-        end_of_frame = true;
-        break;
-
-      case AdditionalFieldHeaderID::zone_set:
-        if (additional_header.length() != NUMBER_OF_BYTES_ZONE_SET)
-        {
-          throw AdditionalFieldUnexpectedSize(fmt::format("Length of zone set field is {}, but should be {}.",
-                                                          additional_header.length(),
-                                                          NUMBER_OF_BYTES_ZONE_SET));
-        }
-        uint8_t zone_set_read_buffer;
-        raw_processing::read<uint8_t>(ss, zone_set_read_buffer);
-        msg_builder.activeZoneset(zone_set_read_buffer);
-        break;
+    }
+    header_pending = false;
 
-      case AdditionalFieldHeaderID::io_pin_data:
-        if (additional_header.length() != io::RAW_CHUNK_LENGTH_IN_BYTES)
-        {
-          throw AdditionalFieldUnexpectedSize(fmt::format("Length of io state field is {}, but should be {}.",
-                                                          additional_header.length(),
-                                                          io::RAW_CHUNK_LENGTH_IN_BYTES));
-        }
-        msg_builder.iOPinData(io::deserializePins(ss));
-        break;
-
-      case AdditionalFieldHeaderID::diagnostics:
-        msg_builder.diagnosticMessages(diagnostic::deserializeMessages(ss));
-        break;
-
-      case AdditionalFieldHeaderID::intensities: {
-        const size_t num_measurements{ static_cast<size_t>(additional_header.length()) /
-                                       NUMBER_OF_BYTES_SINGLE_MEASUREMENT };
-        std::vector<double> intensities;
-        raw_processing::readArray<uint16_t, double>(ss, intensities, num_measurements, std::bind(toIntensities, _1));
-        msg_builder.intensities(intensities);
-        break;
-      }
-      default:
-        throw DecodingFailure(
-            fmt::format("Header Id {:#04x} unknown. Cannot read additional field of monitoring frame on position {}.",
-                        additional_header.id(),
-                        ss.tellp()));
+    if (additional_header.id() == static_cast<AdditionalFieldHeader::Id>(AdditionalFieldHeaderID::end_of_frame))
+    {
+      return DecodingStatus::ok;
+    }
+    const FieldDescriptor* descriptor{ fieldDescriptor(additional_header.id()) };
+    if (descriptor == nullptr)
+    {
+      error.position = reader.position();
+      return DecodingStatus::unknown_field_id;
+    }
+    status = decodeField(*descriptor, additional_header, context);
+    if (status != DecodingStatus::ok)
+    {
+      return status;
     }
   }
+}
+
+std::size_t maxFrameSize(const util::TenthOfDegree& resolution, const bool& intensities_enabled)
+{
+  // Rounded up, since the scanner includes the end angle of the scan.
+  const std::size_t number_of_samples{
+    static_cast<std::size_t>((MAX_SCAN_ANGLE.value() + resolution.value() - 1) / resolution.value()) + 1
+  };
+  std::size_t frame_size{ NUMBER_OF_BYTES_FIXED_FIELDS };
+  frame_size += NUMBER_OF_BYTES_ADDITIONAL_FIELD_HEADER + io::RAW_CHUNK_LENGTH_IN_BYTES;
+  frame_size += NUMBER_OF_BYTES_ADDITIONAL_FIELD_HEADER + NUMBER_OF_BYTES_SCAN_COUNTER;
+  frame_size += NUMBER_OF_BYTES_ADDITIONAL_FIELD_HEADER + NUMBER_OF_BYTES_ZONE_SET;
+  frame_size += NUMBER_OF_BYTES_ADDITIONAL_FIELD_HEADER + diagnostic::RAW_CHUNK_LENGTH_IN_BYTES;
+  frame_size += NUMBER_OF_BYTES_ADDITIONAL_FIELD_HEADER + number_of_samples * NUMBER_OF_BYTES_SINGLE_MEASUREMENT;
+  if (intensities_enabled)
+  {
+    frame_size += NUMBER_OF_BYTES_ADDITIONAL_FIELD_HEADER + number_of_samples * NUMBER_OF_BYTES_SINGLE_INTENSITY;
+  }
+  frame_size += NUMBER_OF_BYTES_END_OF_FRAME;
+  return frame_size;
+}
+
+monitoring_frame::Message deserialize(const data_conversion_layer::RawData& data,
+                                      const std::size_t& num_bytes,
+                                      const DecodeOptions& options)
+{
+  MessageBuilder msg_builder;
+  DecodingError error;
+  const DecodingStatus status{ deserializeInto(data, num_bytes, options, msg_builder, error) };
+  if (status != DecodingStatus::ok)
+  {
+    throwDecodingFailure(status, error);
+  }
   return msg_builder.build();
 }
 
+DecodingStatus tryDeserialize(const data_conversion_layer::RawData& data,
+                              const std::size_t& num_bytes,
+                              const DecodeOptions& options,
+                              Message& msg)
+{
+  MessageBuilder msg_builder;
+  DecodingError error;
+  const DecodingStatus status{ deserializeInto(data, num_bytes, options, msg_builder, error) };
+  if (status == DecodingStatus::ok)
+  {
+    msg = msg_builder.build();
+  }
+  return status;
+}
+
+std::string toString(const DecodingStatus& status)
+{
+  switch (status)
+  {
+    case DecodingStatus::ok:
+      return "ok";
+    case DecodingStatus::truncated_frame:
+      return "truncated frame";
+    case DecodingStatus::field_length_too_large:
+      return "length of additional field too large";
+    case DecodingStatus::unexpected_field_size:
+      return "unexpected size of additional field";
+    case DecodingStatus::unknown_field_id:
+      return "unknown additional field id";
+  }
+  return "unknown status";  // LCOV_EXCL_LINE
+}
+
 AdditionalFieldHeader readAdditionalField(std::istream& is, const std::size_t& max_num_bytes)
 {
   auto const id = raw_processing::read<AdditionalFieldHeader::Id>(is);
@@ -180,39 +467,63 @@ AdditionalFieldHeader readAdditionalField(std::istream& is, const std::size_t& m
   return AdditionalFieldHeader(id, length);
 }
 
+AdditionalFieldHeader readAdditionalField(raw_processing::RawDataReader& reader, const std::size_t& max_num_bytes)
+{
+  AdditionalFieldHeader header{ 0, 0 };
+  DecodingError error;
+  const DecodingStatus status{ readAdditionalFieldHeader(reader, max_num_bytes, header, error) };
+  if (status != DecodingStatus::ok)
+  {
+    throwDecodingFailure(status, error);
+  }
+  return header;
+}
+
 namespace io
 {
-PinData deserializePins(std::istream& is)
+template <typename Source>
+static PinData deserializePinsImpl(Source& src)
 {
   PinData io_pin_data;
 
   raw_processing::read<
-      std::array<uint8_t, 3 * (RAW_CHUNK_LENGTH_RESERVED_IN_BYTES + RAW_CHUNK_PHYSICAL_INPUT_SIGNALS_IN_BYTES)>>(is);
+      std::array<uint8_t, 3 * (RAW_CHUNK_LENGTH_RESERVED_IN_BYTES + RAW_CHUNK_PHYSICAL_INPUT_SIGNALS_IN_BYTES)>>(src);
 
-  raw_processing::read<std::array<uint8_t, RAW_CHUNK_LENGTH_RESERVED_IN_BYTES>>(is);
-  deserializePinField(is, io_pin_data.input_state);
+  raw_processing::read<std::array<uint8_t, RAW_CHUNK_LENGTH_RESERVED_IN_BYTES>>(src);
+  deserializePinField(src, io_pin_data.input_state);
 
-  raw_processing::read<std::array<uint8_t, RAW_CHUNK_LENGTH_RESERVED_IN_BYTES>>(is);
-  deserializePinField(is, io_pin_data.output_state);
+  raw_processing::read<std::array<uint8_t, RAW_CHUNK_LENGTH_RESERVED_IN_BYTES>>(src);
+  deserializePinField(src, io_pin_data.output_state);
 
   return io_pin_data;
 }
+
+PinData deserializePins(std::istream& is)
+{
+  return deserializePinsImpl(is);
+}
+
+PinData deserializePins(raw_processing::RawDataReader& reader)
+{
+  return deserializePinsImpl(reader);
+}
 }  // namespace io
 
 namespace diagnostic
 {
-std::vector<diagnostic::Message> deserializeMessages(std::istream& is)
+template <typename Source>
+static std::vector<diagnostic::Message> deserializeMessagesImpl(Source& src)
 {
   std::vector<diagnostic::Message> diagnostic_messages;
 
   // Read-in unused data fields
-  raw_processing::read<std::array<uint8_t, diagnostic::RAW_CHUNK_UNUSED_OFFSET_IN_BYTES>>(is);
+  raw_processing::read<std::array<uint8_t, diagnostic::RAW_CHUNK_UNUSED_OFFSET_IN_BYTES>>(src);
 
   for (const auto& scanner_id : configuration::VALID_SCANNER_IDS)
   {
     for (size_t byte_n = 0; byte_n < diagnostic::RAW_CHUNK_LENGTH_FOR_ONE_DEVICE_IN_BYTES; byte_n++)
     {
-      const auto raw_byte = raw_processing::read<uint8_t>(is);
+      const auto raw_byte = raw_processing::read<uint8_t>(src);
       const std::bitset<8> raw_bits(raw_byte);
 
       for (size_t bit_n = 0; bit_n < raw_bits.size(); ++bit_n)
@@ -227,18 +538,29 @@ std::vector<diagnostic::Message> deserializeMessages(std::istream& is)
   }
   return diagnostic_messages;
 }
+
+std::vector<diagnostic::Message> deserializeMessages(std::istream& is)
+{
+  return deserializeMessagesImpl(is);
+}
+
+std::vector<diagnostic::Message> deserializeMessages(raw_processing::RawDataReader& reader)
+{
+  return deserializeMessagesImpl(reader);
+}
 }  // namespace diagnostic
 
-FixedFields readFixedFields(std::istream& is)
+template <typename Source>
+static FixedFields readFixedFieldsImpl(Source& src)
 {
-  const auto device_status = raw_processing::read<FixedFields::DeviceStatus>(is);
-  const auto op_code = raw_processing::read<FixedFields::OpCode>(is);
-  const auto working_mode = raw_processing::read<FixedFields::WorkingMode>(is);
-  const auto transaction_type = raw_processing::read<FixedFields::TransactionType>(is);
-  const auto scanner_id = raw_processing::read<configuration::ScannerId>(is);
+  const auto device_status = raw_processing::read<FixedFields::DeviceStatus>(src);
+  const auto op_code = raw_processing::read<FixedFields::OpCode>(src);
+  const auto working_mode = raw_processing::read<FixedFields::WorkingMode>(src);
+  const auto transaction_type = raw_processing::read<FixedFields::TransactionType>(src);
+  const auto scanner_id = raw_processing::read<configuration::ScannerId>(src);
 
-  const auto from_theta = raw_processing::read<int16_t, FixedFields::FromTheta>(is);
-  const auto resolution = raw_processing::read<int16_t, FixedFields::Resolution>(is);
+  const auto from_theta = raw_processing::read<int16_t, FixedFields::FromTheta>(src);
+  const auto resolution = raw_processing::read<int16_t, FixedFields::Resolution>(src);
 
   // LCOV_EXCL_START
   if (OP_CODE_MONITORING_FRAME != op_code)
@@ -265,6 +587,16 @@ FixedFields readFixedFields(std::istream& is)
 
   return FixedFields(device_status, op_code, working_mode, transaction_type, scanner_id, from_theta, resolution);
 }
+
+FixedFields readFixedFields(std::istream& is)
+{
+  return readFixedFieldsImpl(is);
+}
+
+FixedFields readFixedFields(raw_processing::RawDataReader& reader)
+{
+  return readFixedFieldsImpl(reader);
+}
 }  // namespace monitoring_frame
 }  // namespace data_conversion_layer
 }  // namespace psen_scan_v2_standalone
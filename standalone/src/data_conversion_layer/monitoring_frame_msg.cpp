@@ -103,6 +103,92 @@ const std::vector<double>& Message::intensities() const
   }
 }
 
+const std::vector<float>& Message::singlePrecisionMeasurements() const
+{
+  if (single_precision_measurements_.is_initialized())
+  {
+    return single_precision_measurements_.get();
+  }
+  else
+  {
+    throw AdditionalFieldMissing("Single precision measurements");
+  }
+}
+
+const std::vector<float>& Message::singlePrecisionIntensities() const
+{
+  if (single_precision_intensities_.is_initialized())
+  {
+    return single_precision_intensities_.get();
+  }
+  else
+  {
+    throw AdditionalFieldMissing("Single precision intensities");
+  }
+}
+
+const std::vector<uint16_t>& Message::rawMeasurements() const
+{
+  if (raw_measurements_.is_initialized())
+  {
+    return raw_measurements_.get();
+  }
+  else
+  {
+    throw AdditionalFieldMissing("Raw measurements");
+  }
+}
+
+const std::vector<uint16_t>& Message::rawIntensities() const
+{
+  if (raw_intensities_.is_initialized())
+  {
+    return raw_intensities_.get();
+  }
+  else
+  {
+    throw AdditionalFieldMissing("Raw intensities");
+  }
+}
+
+std::size_t Message::numberOfMeasurements() const
+{
+  if (raw_measurements_.is_initialized())
+  {
+    return raw_measurements_->size();
+  }
+  if (single_precision_measurements_.is_initialized())
+  {
+    return single_precision_measurements_->size();
+  }
+  return measurements().size();
+}
+
+std::size_t Message::numberOfIntensities() const
+{
+  if (raw_intensities_.is_initialized())
+  {
+    return raw_intensities_->size();
+  }
+  if (single_precision_intensities_.is_initialized())
+  {
+    return single_precision_intensities_->size();
+  }
+  return intensities().size();
+}
+
+const std::vector<uint8_t>& Message::intensityFlags() const
+{
+  if (intensity_flags_.is_initialized())
+  {
+    return intensity_flags_.get();
+  }
+  else
+  {
+    throw AdditionalFieldMissing("Intensity flags");
+  }
+}
+
 std::vector<diagnostic::Message> Message::diagnosticMessages() const
 {
   if (diagnostic_messages_.is_initialized())
@@ -132,18 +218,30 @@ bool Message::hasIOPinField() const
 
 bool Message::hasMeasurementsField() const
 {
-  return measurements_.is_initialized();
+  return measurements_.is_initialized() || single_precision_measurements_.is_initialized() ||
+         raw_measurements_.is_initialized();
 }
 
 bool Message::hasIntensitiesField() const
 {
-  return intensities_.is_initialized();
+  return intensities_.is_initialized() || single_precision_intensities_.is_initialized() ||
+         raw_intensities_.is_initialized();
 }
 
 bool Message::hasDiagnosticMessagesField() const
 {
   return diagnostic_messages_.is_initialized();
 }
+
+bool Message::isSinglePrecision() const
+{
+  return single_precision_measurements_.is_initialized() || single_precision_intensities_.is_initialized();
+}
+
+bool Message::hasRawSamples() const
+{
+  return raw_measurements_.is_initialized() || raw_intensities_.is_initialized();
+}
 }  // namespace monitoring_frame
 }  // namespace data_conversion_layer
 }  // namespace psen_scan_v2_standalone
@@ -0,0 +1,337 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_field_descriptors.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg_builder.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg_view.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_sample_conversion.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_processing.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace data_conversion_layer
+{
+namespace monitoring_frame
+{
+MessageView::MessageView(const RawDataConstPtr& data, const std::size_t& num_bytes) : data_(data)
+{
+  raw_processing::RawDataReader reader(data_->data(), std::min(num_bytes, data_->size()));
+
+  const FixedFields frame_header{ readFixedFields(reader) };
+  scanner_id_ = frame_header.scannerId();
+  from_theta_ = frame_header.fromTheta();
+  resolution_ = frame_header.resolution();
+
+  while (true)
+  {
+    const AdditionalFieldHeader additional_header{ readAdditionalField(reader, num_bytes) };
+    if (additional_header.id() == static_cast<AdditionalFieldHeader::Id>(AdditionalFieldHeaderID::end_of_frame))
+    {
+      break;
+    }
+    // The fields are validated like in deserialize(), only their decoding is deferred.
+    const FieldDescriptor* descriptor{ fieldDescriptor(additional_header.id()) };
+    if (descriptor == nullptr)
+    {
+      throw DecodingFailure(
+          fmt::format("Header Id {:#04x} unknown. Cannot read additional field of monitoring frame on position {}.",
+                      additional_header.id(),
+                      reader.position()));
+    }
+    if (!fitsFieldSize(descriptor->size, additional_header.length()))
+    {
+      throw AdditionalFieldUnexpectedSize(fmt::format("Length of {} field is {}, but should be {}.",
+                                                      descriptor->name,
+                                                      additional_header.length(),
+                                                      descriptor->size.bytes));
+    }
+
+    const FieldLocation location{ reader.position(), additional_header.length() };
+    switch (descriptor->id)
+    {
+      case AdditionalFieldHeaderID::scan_counter:
+        scan_counter_ = raw_processing::read<uint32_t>(reader);
+        break;
+
+      case AdditionalFieldHeaderID::zone_set:
+        active_zoneset_ = raw_processing::read<uint8_t>(reader);
+        break;
+
+      case AdditionalFieldHeaderID::io_pin_data:
+        io_pin_data_location_ = location;
+        reader.skip(location.length);
+        break;
+
+      case AdditionalFieldHeaderID::diagnostics:
+        diagnostic_messages_location_ = location;
+        reader.skip(location.length);
+        break;
+
+      case AdditionalFieldHeaderID::measurements:
+        measurements_location_ = location;
+        reader.skip(location.length);
+        break;
+
+      case AdditionalFieldHeaderID::intensities:
+        intensities_location_ = location;
+        reader.skip(location.length);
+        break;
+
+      default:
+        // Fields without accessor in the view are skipped.
+        reader.skip(location.length);
+    }
+  }
+}
+
+configuration::ScannerId MessageView::scannerId() const
+{
+  return scanner_id_;
+}
+
+util::TenthOfDegree MessageView::fromTheta() const
+{
+  return from_theta_;
+}
+
+util::TenthOfDegree MessageView::resolution() const
+{
+  return resolution_;
+}
+
+uint32_t MessageView::scanCounter() const
+{
+  if (!scan_counter_.is_initialized())
+  {
+    throw AdditionalFieldMissing("Scan counter");
+  }
+  return scan_counter_.get();
+}
+
+uint8_t MessageView::activeZoneset() const
+{
+  if (!active_zoneset_.is_initialized())
+  {
+    throw AdditionalFieldMissing("Active zoneset");
+  }
+  return active_zoneset_.get();
+}
+
+const io::PinData& MessageView::iOPinData() const
+{
+  if (!io_pin_data_location_.is_initialized())
+  {
+    throw AdditionalFieldMissing("IO pin data");
+  }
+  if (!io_pin_data_.is_initialized())
+  {
+    raw_processing::RawDataReader reader(fieldData(io_pin_data_location_.get()), io_pin_data_location_->length);
+    io_pin_data_ = io::deserializePins(reader);
+  }
+  return io_pin_data_.get();
+}
+
+const std::vector<double>& MessageView::measurements() const
+{
+  if (!measurements_.is_initialized())
+  {
+    measurements_ = std::vector<double>(numberOfMeasurements());
+    decodeMeasurements(measurements_->data());
+  }
+  return measurements_.get();
+}
+
+const std::vector<double>& MessageView::intensities() const
+{
+  if (!intensities_location_.is_initialized())
+  {
+    throw AdditionalFieldMissing("Intensities");
+  }
+  if (!intensities_.is_initialized())
+  {
+    decodeIntensities();
+  }
+  return intensities_.get();
+}
+
+const std::vector<uint8_t>& MessageView::intensityFlags() const
+{
+  if (!intensities_location_.is_initialized())
+  {
+    throw AdditionalFieldMissing("Intensity flags");
+  }
+  if (!intensity_flags_.is_initialized())
+  {
+    decodeIntensities();
+  }
+  return intensity_flags_.get();
+}
+
+const std::vector<diagnostic::Message>& MessageView::diagnosticMessages() const
+{
+  if (!diagnostic_messages_location_.is_initialized())
+  {
+    throw AdditionalFieldMissing("Diagnostic messages");
+  }
+  if (!diagnostic_messages_.is_initialized())
+  {
+    raw_processing::RawDataReader reader(fieldData(diagnostic_messages_location_.get()),
+                                         diagnostic_messages_location_->length);
+    diagnostic_messages_ = diagnostic::deserializeMessages(reader);
+  }
+  return diagnostic_messages_.get();
+}
+
+std::size_t MessageView::numberOfMeasurements() const
+{
+  return measurementsLocation().length / NUMBER_OF_BYTES_SINGLE_MEASUREMENT;
+}
+
+std::size_t MessageView::numberOfIntensities() const
+{
+  return intensitiesLocation().length / NUMBER_OF_BYTES_SINGLE_INTENSITY;
+}
+
+void MessageView::decodeMeasurements(double* measurements) const
+{
+  convertRawMeasurements(fieldData(measurementsLocation()), numberOfMeasurements(), measurements);
+}
+
+void MessageView::decodeMeasurements(float* measurements) const
+{
+  convertRawMeasurements(fieldData(measurementsLocation()), numberOfMeasurements(), measurements);
+}
+
+void MessageView::decodeMeasurements(uint16_t* measurements) const
+{
+  copyRawSamples(fieldData(measurementsLocation()), numberOfMeasurements(), measurements);
+}
+
+void MessageView::decodeIntensities(double* intensities, uint8_t* packed_flags) const
+{
+  convertRawIntensities(fieldData(intensitiesLocation()), numberOfIntensities(), intensities, packed_flags);
+}
+
+void MessageView::decodeIntensities(float* intensities, uint8_t* packed_flags) const
+{
+  convertRawIntensities(fieldData(intensitiesLocation()), numberOfIntensities(), intensities, packed_flags);
+}
+
+void MessageView::decodeIntensities(uint16_t* intensities) const
+{
+  copyRawSamples(fieldData(intensitiesLocation()), numberOfIntensities(), intensities);
+}
+
+bool MessageView::hasScanCounterField() const
+{
+  return scan_counter_.is_initialized();
+}
+
+bool MessageView::hasActiveZonesetField() const
+{
+  return active_zoneset_.is_initialized();
+}
+
+bool MessageView::hasIOPinField() const
+{
+  return io_pin_data_location_.is_initialized();
+}
+
+bool MessageView::hasMeasurementsField() const
+{
+  return measurements_location_.is_initialized();
+}
+
+bool MessageView::hasIntensitiesField() const
+{
+  return intensities_location_.is_initialized();
+}
+
+bool MessageView::hasDiagnosticMessagesField() const
+{
+  return diagnostic_messages_location_.is_initialized();
+}
+
+Message MessageView::toMessage() const
+{
+  MessageBuilder msg_builder;
+  msg_builder.scannerId(scanner_id_).fromTheta(from_theta_).resolution(resolution_);
+  if (hasScanCounterField())
+  {
+    msg_builder.scanCounter(scanCounter());
+  }
+  if (hasActiveZonesetField())
+  {
+    msg_builder.activeZoneset(activeZoneset());
+  }
+  if (hasIOPinField())
+  {
+    msg_builder.iOPinData(iOPinData());
+  }
+  if (hasMeasurementsField())
+  {
+    msg_builder.measurements(measurements());
+  }
+  if (hasIntensitiesField())
+  {
+    msg_builder.intensities(intensities()).intensityFlags(intensityFlags());
+  }
+  if (hasDiagnosticMessagesField())
+  {
+    msg_builder.diagnosticMessages(diagnosticMessages());
+  }
+  return msg_builder.build();
+}
+
+const char* MessageView::fieldData(const FieldLocation& location) const
+{
+  return data_->data() + location.offset;
+}
+
+const MessageView::FieldLocation& MessageView::measurementsLocation() const
+{
+  if (!measurements_location_.is_initialized())
+  {
+    throw AdditionalFieldMissing("Measurements");
+  }
+  return measurements_location_.get();
+}
+
+const MessageView::FieldLocation& MessageView::intensitiesLocation() const
+{
+  if (!intensities_location_.is_initialized())
+  {
+    throw AdditionalFieldMissing("Intensities");
+  }
+  return intensities_location_.get();
+}
+
+void MessageView::decodeIntensities() const
+{
+  intensities_ = std::vector<double>(numberOfIntensities());
+  intensity_flags_ = std::vector<uint8_t>(numberOfIntensityFlagBytes(numberOfIntensities()));
+  decodeIntensities(intensities_->data(), intensity_flags_->data());
+}
+
+}  // namespace monitoring_frame
+}  // namespace data_conversion_layer
+}  // namespace psen_scan_v2_standalone
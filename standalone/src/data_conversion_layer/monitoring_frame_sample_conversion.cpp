@@ -0,0 +1,453 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_sample_conversion.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PSEN_SCAN_V2_STANDALONE_SSE2_AVAILABLE
+#include <emmintrin.h>
+#endif
+
+// The AVX2 kernels are compiled with a function specific target, so that they can be selected at runtime without
+// compiling the whole driver for AVX2. This is only supported by gcc and clang.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PSEN_SCAN_V2_STANDALONE_AVX2_AVAILABLE
+#include <immintrin.h>
+#endif
+
+namespace psen_scan_v2_standalone
+{
+namespace data_conversion_layer
+{
+namespace monitoring_frame
+{
+static constexpr double MILLIMETER_PER_METER{ 1000. };
+static constexpr float MILLIMETER_PER_METER_F{ 1000.f };
+
+static inline uint16_t rawSampleAt(const char* raw, const std::size_t& index)
+{
+  uint16_t value;
+  std::memcpy(&value, raw + index * sizeof(uint16_t), sizeof(uint16_t));
+  return value;
+}
+
+static inline bool isInvalidDistance(const uint16_t& value)
+{
+  return (value == NO_SIGNAL_ARRIVED) || (value == SIGNAL_TOO_LATE);
+}
+
+static void convertMeasurementsScalar(const char* raw,
+                                      const std::size_t& begin,
+                                      const std::size_t& number_of_samples,
+                                      double* measurements)
+{
+  for (std::size_t i = begin; i < number_of_samples; ++i)
+  {
+    const uint16_t value{ rawSampleAt(raw, i) };
+    measurements[i] = isInvalidDistance(value) ? std::numeric_limits<double>::infinity() :
+                                                 static_cast<double>(value) / MILLIMETER_PER_METER;
+  }
+}
+
+static void convertMeasurementsScalar(const char* raw,
+                                      const std::size_t& begin,
+                                      const std::size_t& number_of_samples,
+                                      float* measurements)
+{
+  for (std::size_t i = begin; i < number_of_samples; ++i)
+  {
+    const uint16_t value{ rawSampleAt(raw, i) };
+    measurements[i] = isInvalidDistance(value) ? std::numeric_limits<float>::infinity() :
+                                                 static_cast<float>(value) / MILLIMETER_PER_METER_F;
+  }
+}
+
+template <typename T>
+static void convertIntensitiesScalar(const char* raw,
+                                     const std::size_t& begin,
+                                     const std::size_t& number_of_samples,
+                                     T* intensities,
+                                     uint8_t* packed_flags)
+{
+  for (std::size_t i = begin; i < number_of_samples; ++i)
+  {
+    const uint16_t value{ rawSampleAt(raw, i) };
+    intensities[i] = static_cast<T>(value & INTENSITY_VALUE_MASK);
+
+    const std::size_t flag_position{ i % INTENSITY_FLAGS_PER_BYTE };
+    if (flag_position == 0)
+    {
+      packed_flags[i / INTENSITY_FLAGS_PER_BYTE] = 0;
+    }
+    packed_flags[i / INTENSITY_FLAGS_PER_BYTE] |=
+        static_cast<uint8_t>((value >> INTENSITY_FLAGS_SHIFT) << (2 * flag_position));
+  }
+}
+
+#ifdef PSEN_SCAN_V2_STANDALONE_SSE2_AVAILABLE
+static inline __m128i invalidDistanceMask(const __m128i& raw_values)
+{
+  const __m128i no_signal_arrived{ _mm_set1_epi16(static_cast<int16_t>(NO_SIGNAL_ARRIVED)) };
+  const __m128i signal_too_late{ _mm_set1_epi16(static_cast<int16_t>(SIGNAL_TOO_LATE)) };
+  return _mm_or_si128(_mm_cmpeq_epi16(raw_values, no_signal_arrived), _mm_cmpeq_epi16(raw_values, signal_too_late));
+}
+
+//! @brief Converts the two lowest 32bit values and replaces those marked in the invalid mask by infinity.
+static inline void storeTwoMeasurementsSse2(double* measurements, const __m128i& values, const __m128i& invalid)
+{
+  const __m128d meters{ _mm_div_pd(_mm_cvtepi32_pd(values), _mm_set1_pd(MILLIMETER_PER_METER)) };
+  const __m128d invalid_mask{ _mm_castsi128_pd(_mm_unpacklo_epi32(invalid, invalid)) };
+  const __m128d infinity{ _mm_set1_pd(std::numeric_limits<double>::infinity()) };
+  _mm_storeu_pd(measurements, _mm_or_pd(_mm_and_pd(invalid_mask, infinity), _mm_andnot_pd(invalid_mask, meters)));
+}
+
+static inline void storeFourMeasurementsSse2(float* measurements, const __m128i& values, const __m128i& invalid)
+{
+  const __m128 meters{ _mm_div_ps(_mm_cvtepi32_ps(values), _mm_set1_ps(MILLIMETER_PER_METER_F)) };
+  const __m128 invalid_mask{ _mm_castsi128_ps(invalid) };
+  const __m128 infinity{ _mm_set1_ps(std::numeric_limits<float>::infinity()) };
+  _mm_storeu_ps(measurements, _mm_or_ps(_mm_and_ps(invalid_mask, infinity), _mm_andnot_ps(invalid_mask, meters)));
+}
+
+static void convertMeasurementsSse2(const char* raw, const std::size_t& number_of_samples, double* measurements)
+{
+  const __m128i zero{ _mm_setzero_si128() };
+  std::size_t i{ 0 };
+  for (; i + 8 <= number_of_samples; i += 8)
+  {
+    const __m128i raw_values{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i * sizeof(uint16_t))) };
+    const __m128i invalid{ invalidDistanceMask(raw_values) };
+
+    const __m128i values_low{ _mm_unpacklo_epi16(raw_values, zero) };
+    const __m128i values_high{ _mm_unpackhi_epi16(raw_values, zero) };
+    const __m128i invalid_low{ _mm_unpacklo_epi16(invalid, invalid) };
+    const __m128i invalid_high{ _mm_unpackhi_epi16(invalid, invalid) };
+
+    storeTwoMeasurementsSse2(measurements + i, values_low, invalid_low);
+    storeTwoMeasurementsSse2(measurements + i + 2, _mm_srli_si128(values_low, 8), _mm_srli_si128(invalid_low, 8));
+    storeTwoMeasurementsSse2(measurements + i + 4, values_high, invalid_high);
+    storeTwoMeasurementsSse2(measurements + i + 6, _mm_srli_si128(values_high, 8), _mm_srli_si128(invalid_high, 8));
+  }
+  convertMeasurementsScalar(raw, i, number_of_samples, measurements);
+}
+
+static void convertMeasurementsSse2(const char* raw, const std::size_t& number_of_samples, float* measurements)
+{
+  const __m128i zero{ _mm_setzero_si128() };
+  std::size_t i{ 0 };
+  for (; i + 8 <= number_of_samples; i += 8)
+  {
+    const __m128i raw_values{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i * sizeof(uint16_t))) };
+    const __m128i invalid{ invalidDistanceMask(raw_values) };
+
+    storeFourMeasurementsSse2(
+        measurements + i, _mm_unpacklo_epi16(raw_values, zero), _mm_unpacklo_epi16(invalid, invalid));
+    storeFourMeasurementsSse2(
+        measurements + i + 4, _mm_unpackhi_epi16(raw_values, zero), _mm_unpackhi_epi16(invalid, invalid));
+  }
+  convertMeasurementsScalar(raw, i, number_of_samples, measurements);
+}
+/**
+ * @brief Packs the flag bits of eight raw intensity samples into two bytes.
+ *
+ * The flags of neighboring samples are merged with shifts in 32bit and 64bit lanes, so that the lowest byte of each
+ * 64bit lane holds the flags of four samples.
+ */
+static inline void storeEightIntensityFlagsSse2(uint8_t* packed_flags, const __m128i& raw_values)
+{
+  const __m128i flags{ _mm_srli_epi16(raw_values, INTENSITY_FLAGS_SHIFT) };
+  const __m128i pairs{ _mm_or_si128(flags, _mm_srli_epi32(flags, 16 - 2)) };
+  const __m128i quadruples{ _mm_or_si128(pairs, _mm_srli_epi64(pairs, 32 - 4)) };
+  packed_flags[0] = static_cast<uint8_t>(_mm_cvtsi128_si32(quadruples));
+  packed_flags[1] = static_cast<uint8_t>(_mm_extract_epi16(quadruples, 4));
+}
+
+static void convertIntensitiesSse2(const char* raw,
+                                   const std::size_t& number_of_samples,
+                                   double* intensities,
+                                   uint8_t* packed_flags)
+{
+  const __m128i zero{ _mm_setzero_si128() };
+  const __m128i value_mask{ _mm_set1_epi16(static_cast<int16_t>(INTENSITY_VALUE_MASK)) };
+  std::size_t i{ 0 };
+  for (; i + 8 <= number_of_samples; i += 8)
+  {
+    const __m128i raw_values{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i * sizeof(uint16_t))) };
+    const __m128i values{ _mm_and_si128(raw_values, value_mask) };
+    const __m128i values_low{ _mm_unpacklo_epi16(values, zero) };
+    const __m128i values_high{ _mm_unpackhi_epi16(values, zero) };
+
+    _mm_storeu_pd(intensities + i, _mm_cvtepi32_pd(values_low));
+    _mm_storeu_pd(intensities + i + 2, _mm_cvtepi32_pd(_mm_srli_si128(values_low, 8)));
+    _mm_storeu_pd(intensities + i + 4, _mm_cvtepi32_pd(values_high));
+    _mm_storeu_pd(intensities + i + 6, _mm_cvtepi32_pd(_mm_srli_si128(values_high, 8)));
+    storeEightIntensityFlagsSse2(packed_flags + i / INTENSITY_FLAGS_PER_BYTE, raw_values);
+  }
+  convertIntensitiesScalar(raw, i, number_of_samples, intensities, packed_flags);
+}
+
+static void convertIntensitiesSse2(const char* raw,
+                                   const std::size_t& number_of_samples,
+                                   float* intensities,
+                                   uint8_t* packed_flags)
+{
+  const __m128i zero{ _mm_setzero_si128() };
+  const __m128i value_mask{ _mm_set1_epi16(static_cast<int16_t>(INTENSITY_VALUE_MASK)) };
+  std::size_t i{ 0 };
+  for (; i + 8 <= number_of_samples; i += 8)
+  {
+    const __m128i raw_values{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i * sizeof(uint16_t))) };
+    const __m128i values{ _mm_and_si128(raw_values, value_mask) };
+
+    _mm_storeu_ps(intensities + i, _mm_cvtepi32_ps(_mm_unpacklo_epi16(values, zero)));
+    _mm_storeu_ps(intensities + i + 4, _mm_cvtepi32_ps(_mm_unpackhi_epi16(values, zero)));
+    storeEightIntensityFlagsSse2(packed_flags + i / INTENSITY_FLAGS_PER_BYTE, raw_values);
+  }
+  convertIntensitiesScalar(raw, i, number_of_samples, intensities, packed_flags);
+}
+#endif
+
+#ifdef PSEN_SCAN_V2_STANDALONE_AVX2_AVAILABLE
+__attribute__((target("avx2"))) static void
+convertMeasurementsAvx2(const char* raw, const std::size_t& number_of_samples, double* measurements)
+{
+  const __m128i no_signal_arrived{ _mm_set1_epi16(static_cast<int16_t>(NO_SIGNAL_ARRIVED)) };
+  const __m128i signal_too_late{ _mm_set1_epi16(static_cast<int16_t>(SIGNAL_TOO_LATE)) };
+  const __m256d divisor{ _mm256_set1_pd(MILLIMETER_PER_METER) };
+  const __m256d infinity{ _mm256_set1_pd(std::numeric_limits<double>::infinity()) };
+
+  std::size_t i{ 0 };
+  for (; i + 8 <= number_of_samples; i += 8)
+  {
+    const __m128i raw_values{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i * sizeof(uint16_t))) };
+    const __m128i invalid{ _mm_or_si128(_mm_cmpeq_epi16(raw_values, no_signal_arrived),
+                                        _mm_cmpeq_epi16(raw_values, signal_too_late)) };
+
+    const __m256d meters_low{ _mm256_div_pd(_mm256_cvtepi32_pd(_mm_cvtepu16_epi32(raw_values)), divisor) };
+    const __m256d meters_high{ _mm256_div_pd(
+        _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(_mm_srli_si128(raw_values, 8))), divisor) };
+    const __m256d invalid_low{ _mm256_castsi256_pd(_mm256_cvtepi16_epi64(invalid)) };
+    const __m256d invalid_high{ _mm256_castsi256_pd(_mm256_cvtepi16_epi64(_mm_srli_si128(invalid, 8))) };
+
+    _mm256_storeu_pd(measurements + i, _mm256_blendv_pd(meters_low, infinity, invalid_low));
+    _mm256_storeu_pd(measurements + i + 4, _mm256_blendv_pd(meters_high, infinity, invalid_high));
+  }
+  convertMeasurementsScalar(raw, i, number_of_samples, measurements);
+}
+
+__attribute__((target("avx2"))) static void
+convertMeasurementsAvx2(const char* raw, const std::size_t& number_of_samples, float* measurements)
+{
+  const __m128i no_signal_arrived{ _mm_set1_epi16(static_cast<int16_t>(NO_SIGNAL_ARRIVED)) };
+  const __m128i signal_too_late{ _mm_set1_epi16(static_cast<int16_t>(SIGNAL_TOO_LATE)) };
+  const __m256 divisor{ _mm256_set1_ps(MILLIMETER_PER_METER_F) };
+  const __m256 infinity{ _mm256_set1_ps(std::numeric_limits<float>::infinity()) };
+
+  std::size_t i{ 0 };
+  for (; i + 8 <= number_of_samples; i += 8)
+  {
+    const __m128i raw_values{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i * sizeof(uint16_t))) };
+    const __m128i invalid{ _mm_or_si128(_mm_cmpeq_epi16(raw_values, no_signal_arrived),
+                                        _mm_cmpeq_epi16(raw_values, signal_too_late)) };
+
+    const __m256 meters{ _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(raw_values)), divisor) };
+    const __m256 invalid_mask{ _mm256_castsi256_ps(_mm256_cvtepi16_epi32(invalid)) };
+
+    _mm256_storeu_ps(measurements + i, _mm256_blendv_ps(meters, infinity, invalid_mask));
+  }
+  convertMeasurementsScalar(raw, i, number_of_samples, measurements);
+}
+__attribute__((target("avx2"))) static void convertIntensitiesAvx2(const char* raw,
+                                                                   const std::size_t& number_of_samples,
+                                                                   double* intensities,
+                                                                   uint8_t* packed_flags)
+{
+  const __m128i value_mask{ _mm_set1_epi16(static_cast<int16_t>(INTENSITY_VALUE_MASK)) };
+  std::size_t i{ 0 };
+  for (; i + 8 <= number_of_samples; i += 8)
+  {
+    const __m128i raw_values{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i * sizeof(uint16_t))) };
+    const __m128i values{ _mm_and_si128(raw_values, value_mask) };
+
+    _mm256_storeu_pd(intensities + i, _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(values)));
+    _mm256_storeu_pd(intensities + i + 4, _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(_mm_srli_si128(values, 8))));
+
+    const __m128i flags{ _mm_srli_epi16(raw_values, INTENSITY_FLAGS_SHIFT) };
+    const __m128i pairs{ _mm_or_si128(flags, _mm_srli_epi32(flags, 16 - 2)) };
+    const __m128i quadruples{ _mm_or_si128(pairs, _mm_srli_epi64(pairs, 32 - 4)) };
+    packed_flags[i / INTENSITY_FLAGS_PER_BYTE] = static_cast<uint8_t>(_mm_extract_epi8(quadruples, 0));
+    packed_flags[i / INTENSITY_FLAGS_PER_BYTE + 1] = static_cast<uint8_t>(_mm_extract_epi8(quadruples, 8));
+  }
+  convertIntensitiesScalar(raw, i, number_of_samples, intensities, packed_flags);
+}
+
+__attribute__((target("avx2"))) static void convertIntensitiesAvx2(const char* raw,
+                                                                   const std::size_t& number_of_samples,
+                                                                   float* intensities,
+                                                                   uint8_t* packed_flags)
+{
+  const __m128i value_mask{ _mm_set1_epi16(static_cast<int16_t>(INTENSITY_VALUE_MASK)) };
+  std::size_t i{ 0 };
+  for (; i + 8 <= number_of_samples; i += 8)
+  {
+    const __m128i raw_values{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i * sizeof(uint16_t))) };
+    const __m128i values{ _mm_and_si128(raw_values, value_mask) };
+
+    _mm256_storeu_ps(intensities + i, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(values)));
+
+    const __m128i flags{ _mm_srli_epi16(raw_values, INTENSITY_FLAGS_SHIFT) };
+    const __m128i pairs{ _mm_or_si128(flags, _mm_srli_epi32(flags, 16 - 2)) };
+    const __m128i quadruples{ _mm_or_si128(pairs, _mm_srli_epi64(pairs, 32 - 4)) };
+    packed_flags[i / INTENSITY_FLAGS_PER_BYTE] = static_cast<uint8_t>(_mm_extract_epi8(quadruples, 0));
+    packed_flags[i / INTENSITY_FLAGS_PER_BYTE + 1] = static_cast<uint8_t>(_mm_extract_epi8(quadruples, 8));
+  }
+  convertIntensitiesScalar(raw, i, number_of_samples, intensities, packed_flags);
+}
+#endif
+
+static ConversionKernel detectConversionKernel()
+{
+#ifdef PSEN_SCAN_V2_STANDALONE_AVX2_AVAILABLE
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+  {
+    return ConversionKernel::avx2;
+  }
+#endif
+#ifdef PSEN_SCAN_V2_STANDALONE_SSE2_AVAILABLE
+  return ConversionKernel::sse2;
+#else
+  return ConversionKernel::scalar;
+#endif
+}
+
+ConversionKernel bestConversionKernel()
+{
+  static const ConversionKernel best_kernel{ detectConversionKernel() };
+  return best_kernel;
+}
+
+std::string toString(const ConversionKernel& kernel)
+{
+  switch (kernel)
+  {
+    case ConversionKernel::sse2:
+      return "sse2";
+    case ConversionKernel::avx2:
+      return "avx2";
+    default:
+      return "scalar";
+  }
+}
+
+template <typename T>
+static void convertRawMeasurementsImpl(const char* raw,
+                                       const std::size_t& number_of_samples,
+                                       T* measurements,
+                                       const ConversionKernel& kernel)
+{
+  switch (std::min(kernel, bestConversionKernel()))
+  {
+#ifdef PSEN_SCAN_V2_STANDALONE_AVX2_AVAILABLE
+    case ConversionKernel::avx2:
+      convertMeasurementsAvx2(raw, number_of_samples, measurements);
+      break;
+#endif
+#ifdef PSEN_SCAN_V2_STANDALONE_SSE2_AVAILABLE
+    case ConversionKernel::sse2:
+      convertMeasurementsSse2(raw, number_of_samples, measurements);
+      break;
+#endif
+    default:
+      convertMeasurementsScalar(raw, 0, number_of_samples, measurements);
+      break;
+  }
+}
+
+void convertRawMeasurements(const char* raw,
+                            const std::size_t& number_of_samples,
+                            double* measurements,
+                            const ConversionKernel& kernel)
+{
+  convertRawMeasurementsImpl(raw, number_of_samples, measurements, kernel);
+}
+
+void convertRawMeasurements(const char* raw,
+                            const std::size_t& number_of_samples,
+                            float* measurements,
+                            const ConversionKernel& kernel)
+{
+  convertRawMeasurementsImpl(raw, number_of_samples, measurements, kernel);
+}
+
+template <typename T>
+static void convertRawIntensitiesImpl(const char* raw,
+                                      const std::size_t& number_of_samples,
+                                      T* intensities,
+                                      uint8_t* packed_flags,
+                                      const ConversionKernel& kernel)
+{
+  switch (std::min(kernel, bestConversionKernel()))
+  {
+#ifdef PSEN_SCAN_V2_STANDALONE_AVX2_AVAILABLE
+    case ConversionKernel::avx2:
+      convertIntensitiesAvx2(raw, number_of_samples, intensities, packed_flags);
+      break;
+#endif
+#ifdef PSEN_SCAN_V2_STANDALONE_SSE2_AVAILABLE
+    case ConversionKernel::sse2:
+      convertIntensitiesSse2(raw, number_of_samples, intensities, packed_flags);
+      break;
+#endif
+    default:
+      convertIntensitiesScalar(raw, 0, number_of_samples, intensities, packed_flags);
+      break;
+  }
+}
+
+void convertRawIntensities(const char* raw,
+                           const std::size_t& number_of_samples,
+                           double* intensities,
+                           uint8_t* packed_flags,
+                           const ConversionKernel& kernel)
+{
+  convertRawIntensitiesImpl(raw, number_of_samples, intensities, packed_flags, kernel);
+}
+
+void convertRawIntensities(const char* raw,
+                           const std::size_t& number_of_samples,
+                           float* intensities,
+                           uint8_t* packed_flags,
+                           const ConversionKernel& kernel)
+{
+  convertRawIntensitiesImpl(raw, number_of_samples, intensities, packed_flags, kernel);
+}
+
+void copyRawSamples(const char* raw, const std::size_t& number_of_samples, uint16_t* samples)
+{
+  // Like rawSampleAt() this relies on the host being little-endian.
+  std::memcpy(samples, raw, number_of_samples * sizeof(uint16_t));
+}
+
+}  // namespace monitoring_frame
+}  // namespace data_conversion_layer
+}  // namespace psen_scan_v2_standalone
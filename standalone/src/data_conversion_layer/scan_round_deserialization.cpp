@@ -0,0 +1,201 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/laserscan_conversions.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_decode_options.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg_view.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_sample_conversion.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/scan_round_deserialization.h"
+#include "psen_scan_v2_standalone/io_state.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace data_conversion_layer
+{
+using monitoring_frame::MessageView;
+
+//! @brief Message view together with the reception time of its frame, as expected by summarizeFrames().
+struct MessageViewStamped
+{
+  explicit MessageViewStamped(const monitoring_frame::RawFrameStamped& frame)
+    : msg_(frame.data_, frame.num_bytes_), stamp_(frame.stamp_){};
+  MessageView msg_;
+  int64_t stamp_;
+};
+
+static void decodeIntensitiesInto(const MessageView& view, uint16_t* intensities, std::vector<uint8_t>& /*flags*/)
+{
+  view.decodeIntensities(intensities);
+}
+
+template <typename T>
+static void decodeIntensitiesInto(const MessageView& view, T* intensities, std::vector<uint8_t>& flags)
+{
+  // The flags are not part of a LaserScan, the buffer is only reused to keep the conversion allocation free.
+  flags.resize(monitoring_frame::numberOfIntensityFlagBytes(view.numberOfIntensities()));
+  view.decodeIntensities(intensities, flags.data());
+}
+
+/**
+ * @brief Decodes the samples of each frame straight into the preallocated vectors at the frame's angular position.
+ *
+ * The frames are expected to cover the scan starting at min_angle without overlapping, see framesFitIntoScan().
+ */
+template <typename T>
+static void decodeSamples(const std::vector<MessageViewStamped>& stamped_views,
+                          const util::TenthOfDegree& min_angle,
+                          std::vector<T>& measurements,
+                          std::vector<T>& intensities)
+{
+  std::vector<uint8_t> flags;
+  for (const auto& stamped_view : stamped_views)
+  {
+    const MessageView& view{ stamped_view.msg_ };
+    if (view.numberOfMeasurements() == 0)
+    {
+      continue;
+    }
+    const std::size_t position = positionInScan(view, min_angle);
+    view.decodeMeasurements(measurements.data() + position);
+    if (!intensities.empty())
+    {
+      decodeIntensitiesInto(view, intensities.data() + position, flags);
+    }
+  }
+}
+
+template <typename T>
+static void decodeSamples(const std::vector<MessageViewStamped>& stamped_views,
+                          const util::TenthOfDegree& min_angle,
+                          const std::size_t& number_of_samples,
+                          const bool& with_intensities,
+                          std::vector<T>& measurements,
+                          std::vector<T>& intensities)
+{
+  measurements.resize(number_of_samples);
+  intensities.resize(with_intensities ? number_of_samples : 0);
+  decodeSamples(stamped_views, min_angle, measurements, intensities);
+}
+
+ScanConversionStatus tryDeserializeScanRound(const std::vector<monitoring_frame::RawFrameStamped>& frames,
+                                             const monitoring_frame::DecodeOptions& options,
+                                             boost::optional<LaserScan>& scan)
+{
+  if (frames.empty())
+  {
+    return ScanConversionStatus::no_frames;
+  }
+
+  // First pass: Only the fixed fields and the headers of the additional fields are read.
+  std::vector<MessageViewStamped> stamped_views(frames.begin(), frames.end());
+
+  // The frames are validated like by LaserScanConverter::tryToLaserScan().
+  FramesSummary summary;
+  const ScanConversionStatus status{ summarizeFrames(stamped_views, summary) };
+  if (status != ScanConversionStatus::ok)
+  {
+    return status;
+  }
+
+  const MessageView& first_view{ stamped_views[summary.first_frame_index].msg_ };
+  const auto resolution = first_view.resolution();
+  const auto min_angle = first_view.fromTheta();
+  const auto max_angle = min_angle + resolution * static_cast<int>(summary.number_of_samples - 1);
+  // Frames which do not overlap and fit into a scan of the summed up size cover it without gaps.
+  if (!framesFitIntoScan(stamped_views, min_angle, summary.number_of_samples))
+  {
+    return ScanConversionStatus::theta_angles_mismatch;
+  }
+
+  const MessageViewStamped& earliest{ stamped_views[summary.earliest_frame_index] };
+  const int64_t timestamp{ LaserScanConverter::calculateFirstRayTime(
+      earliest.stamp_, resolution, earliest.msg_.numberOfMeasurements()) };
+
+  scan.emplace(resolution,
+               min_angle,
+               max_angle,
+               stamped_views[0].msg_.scanCounter(),
+               stamped_views[summary.last_frame_index].msg_.activeZoneset(),
+               timestamp,
+               first_view.scannerId());
+
+  // Second pass: The samples are decoded straight into the scan data.
+  const bool with_intensities{ options.decodes(monitoring_frame::DecodeField::intensities) &&
+                               summary.all_frames_with_intensities };
+  const std::size_t& number_of_samples{ summary.number_of_samples };
+  if (options.rawSamples())
+  {
+    LaserScan::RawMeasurementData measurements;
+    LaserScan::RawIntensityData intensities;
+    decodeSamples(stamped_views, min_angle, number_of_samples, with_intensities, measurements, intensities);
+    scan->rawMeasurements(std::move(measurements));
+    scan->rawIntensities(std::move(intensities));
+  }
+  else if (options.singlePrecision())
+  {
+    LaserScan::SinglePrecisionMeasurementData measurements;
+    LaserScan::SinglePrecisionIntensityData intensities;
+    decodeSamples(stamped_views, min_angle, number_of_samples, with_intensities, measurements, intensities);
+    scan->singlePrecisionMeasurements(std::move(measurements));
+    scan->singlePrecisionIntensities(std::move(intensities));
+  }
+  else
+  {
+    LaserScan::MeasurementData measurements;
+    LaserScan::IntensityData intensities;
+    decodeSamples(stamped_views, min_angle, number_of_samples, with_intensities, measurements, intensities);
+    scan->measurements(std::move(measurements));
+    scan->intensities(std::move(intensities));
+  }
+
+  // Like LaserScanConverter the io states follow the reception order (see issue #320).
+  LaserScan::IOData io_states;
+  if (options.decodes(monitoring_frame::DecodeField::io_pin_data))
+  {
+    for (const auto& stamped_view : stamped_views)
+    {
+      if (stamped_view.msg_.hasIOPinField())
+      {
+        io_states.emplace_back(stamped_view.msg_.iOPinData(), stamped_view.stamp_);
+      }
+    }
+  }
+  scan->ioStates(std::move(io_states));
+
+  return ScanConversionStatus::ok;
+}
+
+LaserScan deserializeScanRound(const std::vector<monitoring_frame::RawFrameStamped>& frames,
+                               const monitoring_frame::DecodeOptions& options)
+{
+  boost::optional<LaserScan> scan;
+  const ScanConversionStatus status{ tryDeserializeScanRound(frames, options, scan) };
+  if (status != ScanConversionStatus::ok)
+  {
+    throw ScannerProtocolViolationError(toString(status));
+  }
+  return std::move(scan.get());
+}
+
+}  // namespace data_conversion_layer
+}  // namespace psen_scan_v2_standalone
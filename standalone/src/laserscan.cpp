@@ -16,6 +16,8 @@
 #include <algorithm>
 #include <ostream>
 #include <stdexcept>
+#include <string>
+#include <utility>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -30,6 +32,8 @@ namespace psen_scan_v2_standalone
 {
 static const util::TenthOfDegree MAX_X_AXIS_ROTATION{ 275 };
 
+constexpr uint16_t LaserScan::MISSING_RAW_MEASUREMENT;
+
 LaserScan::LaserScan(const util::TenthOfDegree& resolution,
                      const util::TenthOfDegree& min_scan_angle,
                      const util::TenthOfDegree& max_scan_angle,
@@ -61,6 +65,23 @@ LaserScan::LaserScan(const util::TenthOfDegree& resolution,
   }
 }
 
+LaserScan::LaserScan(const util::TenthOfDegree& resolution,
+                     const util::TenthOfDegree& min_scan_angle,
+                     const util::TenthOfDegree& max_scan_angle,
+                     const uint32_t scan_counter,
+                     const uint8_t active_zoneset,
+                     const int64_t timestamp,
+                     const configuration::ScannerId scanner_id,
+                     MeasurementData measurements,
+                     IntensityData intensities,
+                     IOData io_states)
+  : LaserScan(resolution, min_scan_angle, max_scan_angle, scan_counter, active_zoneset, timestamp, scanner_id)
+{
+  measurements_ = std::move(measurements);
+  intensities_ = std::move(intensities);
+  io_states_ = std::move(io_states);
+}
+
 const util::TenthOfDegree& LaserScan::scanResolution() const
 {
   return resolution_;
@@ -163,6 +184,11 @@ void LaserScan::measurements(const MeasurementData& measurements)
   measurements_ = measurements;
 }
 
+void LaserScan::measurements(MeasurementData&& measurements)
+{
+  measurements_ = std::move(measurements);
+}
+
 LaserScan::MeasurementData& LaserScan::measurements()
 {
   return measurements_;
@@ -178,6 +204,11 @@ void LaserScan::intensities(const IntensityData& intensities)
   intensities_ = intensities;
 }
 
+void LaserScan::intensities(IntensityData&& intensities)
+{
+  intensities_ = std::move(intensities);
+}
+
 // LCOV_EXCL_START
 void LaserScan::setIOStates(const IOData& io_states)
 {
@@ -195,24 +226,141 @@ void LaserScan::ioStates(const IOData& io_states)
   io_states_ = io_states;
 }
 
+void LaserScan::ioStates(IOData&& io_states)
+{
+  io_states_ = std::move(io_states);
+}
+
 const LaserScan::IOData& LaserScan::ioStates() const
 {
   return io_states_;
 }
 
+const LaserScan::SinglePrecisionMeasurementData& LaserScan::singlePrecisionMeasurements() const
+{
+  return single_precision_measurements_;
+}
+
+void LaserScan::singlePrecisionMeasurements(const SinglePrecisionMeasurementData& measurements)
+{
+  single_precision_ = true;
+  single_precision_measurements_ = measurements;
+}
+
+void LaserScan::singlePrecisionMeasurements(SinglePrecisionMeasurementData&& measurements)
+{
+  single_precision_ = true;
+  single_precision_measurements_ = std::move(measurements);
+}
+
+const LaserScan::SinglePrecisionIntensityData& LaserScan::singlePrecisionIntensities() const
+{
+  return single_precision_intensities_;
+}
+
+void LaserScan::singlePrecisionIntensities(const SinglePrecisionIntensityData& intensities)
+{
+  single_precision_ = true;
+  single_precision_intensities_ = intensities;
+}
+
+void LaserScan::singlePrecisionIntensities(SinglePrecisionIntensityData&& intensities)
+{
+  single_precision_ = true;
+  single_precision_intensities_ = std::move(intensities);
+}
+
+bool LaserScan::isSinglePrecision() const
+{
+  return single_precision_;
+}
+
+const LaserScan::RawMeasurementData& LaserScan::rawMeasurements() const
+{
+  return raw_measurements_;
+}
+
+void LaserScan::rawMeasurements(const RawMeasurementData& measurements)
+{
+  raw_samples_ = true;
+  raw_measurements_ = measurements;
+}
+
+void LaserScan::rawMeasurements(RawMeasurementData&& measurements)
+{
+  raw_samples_ = true;
+  raw_measurements_ = std::move(measurements);
+}
+
+const LaserScan::RawIntensityData& LaserScan::rawIntensities() const
+{
+  return raw_intensities_;
+}
+
+void LaserScan::rawIntensities(const RawIntensityData& intensities)
+{
+  raw_samples_ = true;
+  raw_intensities_ = intensities;
+}
+
+void LaserScan::rawIntensities(RawIntensityData&& intensities)
+{
+  raw_samples_ = true;
+  raw_intensities_ = std::move(intensities);
+}
+
+bool LaserScan::hasRawSamples() const
+{
+  return raw_samples_;
+}
+
+std::size_t LaserScan::numberOfMissingMeasurements() const
+{
+  return missing_measurements_;
+}
+
+void LaserScan::numberOfMissingMeasurements(const std::size_t& number_of_missing_measurements)
+{
+  missing_measurements_ = number_of_missing_measurements;
+}
+
+bool LaserScan::isPartial() const
+{
+  return missing_measurements_ > 0;
+}
+
+template <typename MeasurementData, typename IntensityData>
+static std::string formatLaserScan(const LaserScan& scan,
+                                   const MeasurementData& measurements,
+                                   const IntensityData& intensities)
+{
+  return fmt::format("LaserScan(timestamp = {} nsec, scanCounter = {}, minScanAngle = {} deg, maxScanAngle = {} deg, "
+                     "resolution = {} deg, active_zoneset = {}, measurements = {}, intensities = {}, io_states = {})",
+                     scan.timestamp(),
+                     scan.scanCounter(),
+                     scan.minScanAngle().value() / 10.,
+                     scan.maxScanAngle().value() / 10.,
+                     scan.scanResolution().value() / 10.,
+                     scan.activeZoneset(),
+                     util::formatRange(measurements),
+                     util::formatRange(intensities),
+                     util::formatRange(scan.ioStates()));
+}
+
 std::ostream& operator<<(std::ostream& os, const LaserScan& scan)
 {
-  os << fmt::format("LaserScan(timestamp = {} nsec, scanCounter = {}, minScanAngle = {} deg, maxScanAngle = {} deg, "
-                    "resolution = {} deg, active_zoneset = {}, measurements = {}, intensities = {}, io_states = {})",
-                    scan.timestamp(),
-                    scan.scanCounter(),
-                    scan.minScanAngle().value() / 10.,
-                    scan.maxScanAngle().value() / 10.,
-                    scan.scanResolution().value() / 10.,
-                    scan.activeZoneset(),
-                    util::formatRange(scan.measurements()),
-                    util::formatRange(scan.intensities()),
-                    util::formatRange(scan.ioStates()));
+  if (scan.hasRawSamples())
+  {
+    os << formatLaserScan(scan, scan.rawMeasurements(), scan.rawIntensities());
+  }
+  else if (scan.isSinglePrecision())
+  {
+    os << formatLaserScan(scan, scan.singlePrecisionMeasurements(), scan.singlePrecisionIntensities());
+  }
+  else
+  {
+    os << formatLaserScan(scan, scan.measurements(), scan.intensities());
+  }
   return os;
 }
 
@@ -0,0 +1,32 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstddef>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
+#include "psen_scan_v2_standalone/scanner_configuration.h"
+
+namespace psen_scan_v2_standalone
+{
+std::size_t ScannerConfiguration::maxFrameSize() const
+{
+  if (max_frame_size_)
+  {
+    return *max_frame_size_;
+  }
+  return data_conversion_layer::monitoring_frame::maxFrameSize(scan_resolution_, intensities_enabled_);
+}
+
+}  // namespace psen_scan_v2_standalone
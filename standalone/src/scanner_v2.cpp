@@ -16,7 +16,9 @@
 #include "psen_scan_v2_standalone/scanner_v2.h"
 
 #include <cassert>
+#include <memory>
 #include <stdexcept>
+#include <utility>
 
 #include "psen_scan_v2_standalone/scanner_configuration.h"
 
@@ -39,6 +41,39 @@ std::unique_ptr<util::Watchdog> WatchdogFactory::create(const util::Watchdog::Ti
 }
 
 ScannerV2::ScannerV2(const ScannerConfiguration& scanner_config, const LaserScanCallback& laser_scan_callback)
+  : ScannerV2(scanner_config, laser_scan_callback, nullptr)
+{
+}
+
+ScannerV2::ScannerV2(const ScannerConfiguration& scanner_config,
+                     const SharedLaserScanCallback& laser_scan_callback)
+  : ScannerV2(scanner_config, laser_scan_callback, nullptr)
+{
+}
+
+ScannerV2::ScannerV2(const ScannerConfiguration& scanner_config, std::nullptr_t /*laser_scan_callback*/)
+  : ScannerV2(scanner_config, LaserScanCallback())
+{
+}
+
+ScannerV2::ScannerV2(const ScannerConfiguration& scanner_config,
+                     const LaserScanCallback& laser_scan_callback,
+                     boost::asio::io_service& io_service)
+  : ScannerV2(scanner_config, laser_scan_callback, &io_service)
+{
+}
+
+ScannerV2::ScannerV2(const ScannerConfiguration& scanner_config,
+                     const SharedLaserScanCallback& laser_scan_callback,
+                     boost::asio::io_service& io_service)
+  : ScannerV2(scanner_config, laser_scan_callback, &io_service)
+{
+}
+
+template <typename Callback>
+ScannerV2::ScannerV2(const ScannerConfiguration& scanner_config,
+                     const Callback& laser_scan_callback,
+                     boost::asio::io_service* io_service)
   : IScanner(scanner_config, laser_scan_callback)
   , sm_(new ScannerStateMachine(IScanner::config(),
                                 // LCOV_EXCL_START
@@ -52,9 +87,10 @@ ScannerV2::ScannerV2(const ScannerConfiguration& scanner_config, const LaserScan
                                 BIND_EVENT(MonitoringFrameReceivedError),
                                 std::bind(&ScannerV2::scannerStartedCallback, this),
                                 std::bind(&ScannerV2::scannerStoppedCallback, this),
-                                IScanner::laserScanCallback(),
+                                std::bind(&ScannerV2::informUserAboutLaserScan, this, std::placeholders::_1),
                                 BIND_EVENT(scanner_events::StartTimeout),
-                                BIND_EVENT(scanner_events::MonitoringFrameTimeout)))
+                                BIND_EVENT(scanner_events::MonitoringFrameTimeout),
+                                io_service))
 // LCOV_EXCL_STOP
 {
   const std::lock_guard<std::mutex> lock(member_mutex_);
@@ -105,6 +141,18 @@ std::future<void> ScannerV2::stop()
   return scanner_has_stopped_.value().get_future();
 }
 
+communication_layer::ReceiveStatistics ScannerV2::receiveStatistics()
+{
+  const std::lock_guard<std::mutex> lock(member_mutex_);
+  return sm_->dataReceiveStatistics();
+}
+
+MonitoringFrameStatistics ScannerV2::monitoringFrameStatistics()
+{
+  const std::lock_guard<std::mutex> lock(member_mutex_);
+  return sm_->monitoringFrameStatistics();
+}
+
 // PLEASE NOTE:
 // The callback does not take a member lock because the callback is always called
 // via call to triggerEvent() or triggerEventWithParam() which already take the mutex.
@@ -139,4 +187,14 @@ void ScannerV2::scannerStopErrorCallback(const std::string& error_msg)
   scanner_has_stopped_ = boost::none;
 }
 
+void ScannerV2::informUserAboutLaserScan(LaserScan&& scan)
+{
+  if (IScanner::sharedLaserScanCallback())
+  {
+    IScanner::sharedLaserScanCallback()(std::make_shared<const LaserScan>(std::move(scan)));
+    return;
+  }
+  IScanner::laserScanCallback()(scan);
+}
+
 }  // namespace psen_scan_v2_standalone
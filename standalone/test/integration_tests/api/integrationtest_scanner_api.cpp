@@ -63,6 +63,7 @@ class UserCallbacks
 {
 public:
   MOCK_METHOD1(LaserScanCallback, void(const LaserScan&));
+  MOCK_METHOD1(SharedLaserScanCallback, void(const LaserScanConstPtr&));
 };
 
 #define EXPECT_STOP_REQUEST_CALL(hw_mock)                                                                              \
@@ -117,11 +118,14 @@ protected:
   void setUpScannerV2Driver();
   void setUpScannerHwMock();
   ScannerConfiguration generateScannerConfig(const std::string& host_ip, bool fragmented);
+  ScannerConfigurationBuilder createScannerConfigBuilder(const std::string& host_ip, bool fragmented);
 
 protected:
   const PortHolder port_holder_{ ++GLOBAL_PORT_HOLDER };
   std::unique_ptr<ScannerConfiguration> config_;
   UserCallbacks user_callbacks_;
+  //! Has to outlive the driver using it.
+  communication_layer::IoServiceThreadPool io_service_pool_{ 2 };
   std::unique_ptr<ScannerV2> driver_;
   std::unique_ptr<StrictMock<ScannerMock>> hw_mock_;
 };
@@ -138,6 +142,11 @@ void ScannerAPITests::setUpScannerConfig(const std::string& host_ip, bool fragme
 }
 
 ScannerConfiguration ScannerAPITests::generateScannerConfig(const std::string& host_ip, bool fragmented)
+{
+  return createScannerConfigBuilder(host_ip, fragmented);
+}
+
+ScannerConfigurationBuilder ScannerAPITests::createScannerConfigBuilder(const std::string& host_ip, bool fragmented)
 {
   return ScannerConfigurationBuilder(SCANNER_IP_ADDRESS)
       .hostIP(host_ip)
@@ -205,12 +214,86 @@ TEST_F(ScannerAPITests, shouldReceiveStartRequestWithCorrectHostIpWhenUsingAutoI
   EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
 }
 
+TEST_F(ScannerAPITests, shouldCallLaserScanCallbackWhenRunningOnSharedIoService)
+{
+  setUpScannerConfig(HOST_IP_ADDRESS, UNFRAGMENTED_SCAN);
+  driver_.reset(new ScannerV2(*config_,
+                              std::bind(&UserCallbacks::LaserScanCallback, &user_callbacks_, std::placeholders::_1),
+                              io_service_pool_.ioService()));
+  setUpScannerHwMock();
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  util::Barrier monitoring_frame_barrier;
+  EXPECT_CALLBACK_WILL_OPEN_BARRIER(user_callbacks_, msgs, monitoring_frame_barrier);
+
+  hw_mock_->sendMonitoringFrames(msgs);
+
+  EXPECT_TRUE(monitoring_frame_barrier.waitTillRelease(2s)) << "Laser scan callback not called";
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
+TEST_F(ScannerAPITests, shouldCallLaserScanCallbackWhenReceivingViaIoUringOnSharedIoService)
+{
+  config_.reset(new ScannerConfiguration(
+      createScannerConfigBuilder(HOST_IP_ADDRESS, UNFRAGMENTED_SCAN).enableIoUringReceive().build()));
+  driver_.reset(new ScannerV2(*config_,
+                              std::bind(&UserCallbacks::LaserScanCallback, &user_callbacks_, std::placeholders::_1),
+                              io_service_pool_.ioService()));
+  setUpScannerHwMock();
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  util::Barrier monitoring_frame_barrier;
+  EXPECT_CALLBACK_WILL_OPEN_BARRIER(user_callbacks_, msgs, monitoring_frame_barrier);
+
+  hw_mock_->sendMonitoringFrames(msgs);
+
+  EXPECT_TRUE(monitoring_frame_barrier.waitTillRelease(2s)) << "Laser scan callback not called";
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
 TEST_F(ScannerAPITests, shouldThrowWhenConstructedWithInvalidLaserScanCallback)
 {
   setUpScannerConfig();
   EXPECT_THROW(ScannerV2 scanner(*config_, nullptr);, std::invalid_argument);
 }
 
+TEST_F(ScannerAPITests, shouldThrowWhenConstructedWithInvalidSharedLaserScanCallback)
+{
+  setUpScannerConfig();
+  EXPECT_THROW(ScannerV2 scanner(*config_, IScanner::SharedLaserScanCallback());, std::invalid_argument);
+}
+
+TEST_F(ScannerAPITests, shouldShareOwnershipOfScanWithSharedLaserScanCallback)
+{
+  setUpScannerConfig(HOST_IP_ADDRESS, UNFRAGMENTED_SCAN);
+  driver_.reset(new ScannerV2(
+      *config_, std::bind(&UserCallbacks::SharedLaserScanCallback, &user_callbacks_, std::placeholders::_1)));
+  setUpScannerHwMock();
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  const auto timestamp{ util::getCurrentTime() };
+  const auto scan{ createReferenceScan(msgs, timestamp) };
+  util::Barrier monitoring_frame_barrier;
+  LaserScanConstPtr retained_scan;
+  EXPECT_CALL(user_callbacks_,
+              SharedLaserScanCallback(
+                  Pointee(AllOf(ScanDataEqual(scan), ScanTimestampsInExpectedTimeframe(scan, timestamp)))))
+      .WillOnce(DoAll(SaveArg<0>(&retained_scan), OpenBarrier(&monitoring_frame_barrier)));
+
+  hw_mock_->sendMonitoringFrames(msgs);
+
+  EXPECT_TRUE(monitoring_frame_barrier.waitTillRelease(2s)) << "Laser scan callback not called";
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+
+  ASSERT_TRUE(retained_scan != nullptr);
+  EXPECT_EQ(2u, retained_scan->scanCounter());
+}
+
 TEST_F(ScannerAPITestsDefaultSetUp, shouldSendStartRequestAndReturnValidFutureWhenLaunchingWithValidConfig)
 {
   util::Barrier start_req_received_barrier;
@@ -622,6 +705,26 @@ TEST_F(ScannerAPITestsUnfragmented, shouldCallLaserScanCallbackOnlyOneTimeWithAl
   EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
 }
 
+TEST_F(ScannerAPITestsUnfragmented, shouldCountReceivedMonitoringFrames)
+{
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  util::Barrier monitoring_frame_barrier;
+  EXPECT_CALLBACK_WILL_OPEN_BARRIER(user_callbacks_, msgs, monitoring_frame_barrier);
+
+  hw_mock_->sendMonitoringFrames(msgs);
+
+  ASSERT_TRUE(monitoring_frame_barrier.waitTillRelease(2s));
+  const auto receive_statistics{ driver_->receiveStatistics() };
+  EXPECT_EQ(msgs.size(), receive_statistics.datagrams);
+  EXPECT_EQ(0u, receive_statistics.kernel_drops);
+  EXPECT_EQ(0u, receive_statistics.errors);
+  EXPECT_EQ(0u, driver_->monitoringFrameStatistics().rounds_ended_early);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
 TEST_F(ScannerAPITestsUnfragmented, shouldShowOneUserMsgIfFirstTwoScanRoundsStartEarly)
 {
   INJECT_LOG_MOCK
@@ -687,6 +790,74 @@ TEST_F(ScannerAPITestsUnfragmented, shouldIgnoreMonitoringFrameOfFormerScanRound
   REMOVE_LOG_MOCK
 }
 
+TEST_F(ScannerAPITests, shouldPassOnIncompleteScanRoundAsPartialScan)
+{
+  config_.reset(new ScannerConfiguration(
+      createScannerConfigBuilder(HOST_IP_ADDRESS, UNFRAGMENTED_SCAN).enablePartialScans().build()));
+  setUpScannerV2Driver();
+  setUpScannerHwMock();
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto ignored_short_first_round = createMonitoringFrameMsgsForScanRound(2, 1);
+  auto partial_round = createMonitoringFrameMsgsForScanRound(3, 6);
+  partial_round.erase(partial_round.begin() + 2);
+  const auto next_round = createMonitoringFrameMsgsForScanRound(4, 1);
+
+  util::Barrier monitoring_frame_barrier;
+  EXPECT_CALL(user_callbacks_,
+              LaserScanCallback(AllOf(Property(&LaserScan::scanCounter, 3u), Property(&LaserScan::isPartial, true))))
+      .WillOnce(OpenBarrier(&monitoring_frame_barrier));
+
+  for (const auto& msgs : { ignored_short_first_round, partial_round, next_round })
+  {
+    hw_mock_->sendMonitoringFrames(msgs);
+  }
+
+  EXPECT_TRUE(monitoring_frame_barrier.waitTillRelease(2s)) << "Laser scan callback not called";
+  EXPECT_EQ(1u, driver_->monitoringFrameStatistics().partial_scans);
+  EXPECT_EQ(0u, driver_->monitoringFrameStatistics().rounds_ended_early);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
+TEST_F(ScannerAPITests, shouldRejectIncompleteScanRoundWithZeroResolution)
+{
+  config_.reset(new ScannerConfiguration(
+      createScannerConfigBuilder(HOST_IP_ADDRESS, UNFRAGMENTED_SCAN).enablePartialScans().build()));
+  setUpScannerV2Driver();
+  setUpScannerHwMock();
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto ignored_short_first_round = createMonitoringFrameMsgsForScanRound(2, 1);
+  std::vector<data_conversion_layer::monitoring_frame::Message> invalid_partial_round;
+  for (int i = 0; i < 5; ++i)
+  {
+    invalid_partial_round.push_back(
+        createMonitoringFrameMsgBuilder(util::TenthOfDegree(100 * i), util::TenthOfDegree(100 * (i + 1)))
+            .scanCounter(3)
+            .resolution(util::TenthOfDegree(0)));
+  }
+  auto partial_round = createMonitoringFrameMsgsForScanRound(4, 6);
+  partial_round.erase(partial_round.begin() + 2);
+  const auto next_round = createMonitoringFrameMsgsForScanRound(5, 1);
+
+  util::Barrier monitoring_frame_barrier;
+  EXPECT_CALL(user_callbacks_,
+              LaserScanCallback(AllOf(Property(&LaserScan::scanCounter, 4u), Property(&LaserScan::isPartial, true))))
+      .WillOnce(OpenBarrier(&monitoring_frame_barrier));
+
+  for (const auto& msgs : { ignored_short_first_round, invalid_partial_round, partial_round, next_round })
+  {
+    hw_mock_->sendMonitoringFrames(msgs);
+  }
+
+  EXPECT_TRUE(monitoring_frame_barrier.waitTillRelease(2s)) << "Laser scan callback not called";
+  EXPECT_EQ(1u, driver_->monitoringFrameStatistics().rejected_scans);
+  EXPECT_EQ(1u, driver_->monitoringFrameStatistics().partial_scans);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
 }  // namespace psen_scan_v2_standalone_test
 
 int main(int argc, char* argv[])
@@ -17,6 +17,9 @@
 #include <functional>
 #include <chrono>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <boost/asio.hpp>
 
@@ -25,8 +28,10 @@
 
 #include "psen_scan_v2_standalone/util/async_barrier.h"
 #include "psen_scan_v2_standalone/util/gtest_expectations.h"
+#include "psen_scan_v2_standalone/util/ip_conversion.h"
 #include "psen_scan_v2_standalone/util/matchers_and_actions.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+#include "psen_scan_v2_standalone/communication_layer/io_service_thread_pool.h"
 #include "psen_scan_v2_standalone/communication_layer/udp_client.h"
 
 #include "psen_scan_v2_standalone/communication_layer/mock_udp_server.h"
@@ -159,6 +164,86 @@ TEST_F(UdpClientTests, Should_NotCallErrorCallback_WhenDestroyedWhileAsyncReceiv
   udp_client_->close();
 }
 
+TEST_F(UdpClientTests, Should_NotCallErrorCallback_WhenDestroyedWhileAsyncReceivePendingOnSharedIoService)
+{
+  communication_layer::IoServiceThreadPool io_service_pool(2);
+  udp_client_.reset();
+  udp_client_.reset(new communication_layer::UdpClientImpl(std::bind(&UdpClientTests::handleNewData, this, _1, _2, _3),
+                                                           std::bind(&UdpClientTests::handleError, this, _1),
+                                                           HOST_UDP_PORT,
+                                                           util::convertIP(UDP_MOCK_IP_ADDRESS),
+                                                           UDP_MOCK_PORT,
+                                                           data_conversion_layer::MAX_UDP_PAKET_SIZE,
+                                                           &io_service_pool.ioService()));
+  EXPECT_CALL(*this, handleError(_)).Times(0);
+
+  udp_client_->startAsyncReceiving();
+  udp_client_.reset();
+}
+
+TEST_F(UdpClientTests, shouldNotReceiveDataAfterStop)
+{
+  EXPECT_CALL(*this, handleNewData(_, _, _)).Times(0);
+  EXPECT_CALL(*this, handleError(_)).Times(0);
+
+  udp_client_->startAsyncReceiving();
+  udp_client_->stop();
+  sendTestDataToClient();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+}
+
+TEST_F(UdpClientTests, shouldRunClientsSharingAnIoServiceInItsThread)
+{
+  static constexpr unsigned short SECOND_HOST_UDP_PORT{ UDP_MOCK_PORT + 2 };
+  const udp::endpoint second_host_endpoint{ boost::asio::ip::address_v4(util::convertIP(HOST_IP_ADDRESS)),
+                                            SECOND_HOST_UDP_PORT };
+
+  std::mutex thread_ids_mutex;
+  std::vector<std::thread::id> thread_ids;
+  util::Barrier both_clients_received_data_barrier;
+  EXPECT_CALL(*this, handleNewData(_, send_array_.size(), _))
+      .Times(2)
+      .WillRepeatedly(Invoke([&](const data_conversion_layer::RawDataConstPtr& /*data*/,
+                                 const std::size_t& /*num_bytes*/,
+                                 const int64_t& /*timestamp*/) {
+        std::lock_guard<std::mutex> lock(thread_ids_mutex);
+        thread_ids.push_back(std::this_thread::get_id());
+        if (thread_ids.size() == 2)
+        {
+          both_clients_received_data_barrier.release();
+        }
+      }));
+
+  communication_layer::IoServiceThreadPool io_service_pool(1);
+  udp_client_.reset();
+  udp_client_.reset(new communication_layer::UdpClientImpl(std::bind(&UdpClientTests::handleNewData, this, _1, _2, _3),
+                                                           std::bind(&UdpClientTests::handleError, this, _1),
+                                                           HOST_UDP_PORT,
+                                                           util::convertIP(UDP_MOCK_IP_ADDRESS),
+                                                           UDP_MOCK_PORT,
+                                                           data_conversion_layer::MAX_UDP_PAKET_SIZE,
+                                                           &io_service_pool.ioService()));
+  communication_layer::UdpClientImpl second_udp_client(std::bind(&UdpClientTests::handleNewData, this, _1, _2, _3),
+                                                       std::bind(&UdpClientTests::handleError, this, _1),
+                                                       SECOND_HOST_UDP_PORT,
+                                                       util::convertIP(UDP_MOCK_IP_ADDRESS),
+                                                       UDP_MOCK_PORT,
+                                                       data_conversion_layer::MAX_UDP_PAKET_SIZE,
+                                                       &io_service_pool.ioService());
+
+  udp_client_->startAsyncReceiving();
+  second_udp_client.startAsyncReceiving();
+  sendTestDataToClient();
+  mock_udp_server_.asyncSend(second_host_endpoint, send_array_);
+
+  ASSERT_TRUE(both_clients_received_data_barrier.waitTillRelease(DEFAULT_TIMEOUT))
+      << "Udp clients did not receive data";
+  EXPECT_EQ(thread_ids.at(0), thread_ids.at(1));
+  EXPECT_NE(std::this_thread::get_id(), thread_ids.at(0));
+  // The clients have to be closed before the io_service is stopped.
+  udp_client_.reset();
+}
+
 TEST_F(UdpClientTests, testErrorHandlingForReceive)
 {
   util::Barrier error_callback_called_barrier;
@@ -183,6 +268,23 @@ TEST_F(UdpClientTests, testWriteOperation)
   EXPECT_TRUE(server_mock_received_data_barrier.waitTillRelease(DEFAULT_TIMEOUT)) << "Server mock did not receive data";
 }
 
+TEST_F(UdpClientTests, shouldKeepSharedDataAliveUntilSent)
+{
+  const auto expected_data = createRawData("Hello!");
+  data_conversion_layer::RawDataConstPtr write_buf{ std::make_shared<const data_conversion_layer::RawData>(
+      expected_data) };
+
+  util::Barrier server_mock_received_data_barrier;
+  EXPECT_CALL(*this, receivedUdpMsg(_, expected_data)).WillOnce(OpenBarrier(&server_mock_received_data_barrier));
+
+  mock_udp_server_.asyncReceive();
+  udp_client_->write(write_buf);
+  // The client is the only owner left.
+  write_buf.reset();
+
+  EXPECT_TRUE(server_mock_received_data_barrier.waitTillRelease(DEFAULT_TIMEOUT)) << "Server mock did not receive data";
+}
+
 TEST_F(UdpClientTests, testWritingWhileReceiving)
 {
   auto write_buf = createRawData("Hello!");
@@ -204,6 +306,411 @@ TEST_F(UdpClientTests, testWritingWhileReceiving)
   EXPECT_TRUE(client_received_data_barrier.waitTillRelease(DEFAULT_TIMEOUT)) << "Udp client did not receive data";
 }
 
+TEST_F(UdpClientTests, shouldNotModifyReceivedDataKeptAfterCallback)
+{
+  static constexpr std::size_t NUMBER_OF_DATAGRAMS{ 20 };
+
+  std::vector<data_conversion_layer::RawDataConstPtr> kept_data;
+  util::Barrier client_received_data_barrier;
+  EXPECT_CALL(*this, handleNewData(_, 1u, _))
+      .Times(NUMBER_OF_DATAGRAMS)
+      .WillRepeatedly(Invoke([&](const data_conversion_layer::RawDataConstPtr& data,
+                                 const std::size_t& /*num_bytes*/,
+                                 const int64_t& /*timestamp*/) {
+        kept_data.push_back(data);
+        if (kept_data.size() == NUMBER_OF_DATAGRAMS)
+        {
+          client_received_data_barrier.release();
+        }
+      }));
+
+  udp_client_->startAsyncReceiving();
+  for (std::size_t i = 0; i < NUMBER_OF_DATAGRAMS; ++i)
+  {
+    mock_udp_server_.asyncSend(host_endpoint, { static_cast<char>(i) });
+  }
+
+  ASSERT_TRUE(client_received_data_barrier.waitTillRelease(DEFAULT_TIMEOUT)) << "Udp client did not receive data";
+  for (std::size_t i = 0; i < NUMBER_OF_DATAGRAMS; ++i)
+  {
+    EXPECT_EQ(static_cast<char>(i), kept_data.at(i)->at(0)) << "Datagram " << i << " modified after callback";
+  }
+}
+
+TEST_F(UdpClientTests, shouldReportDatagramsExceedingMaxDatagramSize)
+{
+  udp_client_.reset();
+  udp_client_.reset(new communication_layer::UdpClientImpl(std::bind(&UdpClientTests::handleNewData, this, _1, _2, _3),
+                                                           std::bind(&UdpClientTests::handleError, this, _1),
+                                                           HOST_UDP_PORT,
+                                                           util::convertIP(UDP_MOCK_IP_ADDRESS),
+                                                           UDP_MOCK_PORT,
+                                                           send_array_.size() - 1));
+
+  util::Barrier error_callback_called_barrier;
+  EXPECT_CALL(*this, handleNewData(_, _, _)).Times(0);
+  EXPECT_CALL(*this, handleError(_)).WillOnce(OpenBarrier(&error_callback_called_barrier));
+
+  udp_client_->startAsyncReceiving(communication_layer::ReceiveMode::single);
+  sendTestDataToClient();
+  ASSERT_TRUE(error_callback_called_barrier.waitTillRelease(DEFAULT_TIMEOUT))
+      << "Error callback should have been called";
+  EXPECT_EQ(1u, udp_client_->receiveStatistics().errors);
+  EXPECT_EQ(0u, udp_client_->receiveStatistics().datagrams);
+}
+
+TEST_F(UdpClientTests, shouldCountReceivedDatagramsAndBytes)
+{
+  static constexpr std::size_t NUMBER_OF_DATAGRAMS{ 3 };
+
+  std::size_t number_of_received_datagrams{ 0 };
+  util::Barrier client_received_data_barrier;
+  EXPECT_CALL(*this, handleNewData(_, send_array_.size(), _))
+      .Times(NUMBER_OF_DATAGRAMS)
+      .WillRepeatedly(Invoke([&](const data_conversion_layer::RawDataConstPtr& /*data*/,
+                                 const std::size_t& /*num_bytes*/,
+                                 const int64_t& /*timestamp*/) {
+        if (++number_of_received_datagrams == NUMBER_OF_DATAGRAMS)
+        {
+          client_received_data_barrier.release();
+        }
+      }));
+
+  udp_client_->startAsyncReceiving();
+  for (std::size_t i = 0; i < NUMBER_OF_DATAGRAMS; ++i)
+  {
+    sendTestDataToClient();
+  }
+
+  ASSERT_TRUE(client_received_data_barrier.waitTillRelease(DEFAULT_TIMEOUT)) << "Udp client did not receive data";
+  const communication_layer::ReceiveStatistics statistics{ udp_client_->receiveStatistics() };
+  EXPECT_EQ(NUMBER_OF_DATAGRAMS, statistics.datagrams);
+  EXPECT_EQ(NUMBER_OF_DATAGRAMS * send_array_.size(), statistics.bytes);
+  EXPECT_EQ(0u, statistics.kernel_drops);
+  EXPECT_EQ(0u, statistics.errors);
+  EXPECT_EQ(1u, statistics.max_batch_size);
+}
+
+#ifdef __linux__
+class UdpClientBurstTests : public UdpClientTests
+{
+protected:
+  void testReceivingBurstsInOrder(const communication_layer::ReceiveMode& modi);
+};
+
+void UdpClientBurstTests::testReceivingBurstsInOrder(const communication_layer::ReceiveMode& modi)
+{
+  static constexpr std::size_t BURST_SIZE{ 40 };
+  static constexpr std::size_t NUMBER_OF_BURSTS{ 2 };
+
+  std::vector<char> received_sequence_numbers;
+  util::Barrier client_received_data_barrier;
+  EXPECT_CALL(*this, handleNewData(_, 1u, _))
+      .Times(BURST_SIZE * NUMBER_OF_BURSTS)
+      .WillRepeatedly(Invoke([&](const data_conversion_layer::RawDataConstPtr& data,
+                                 const std::size_t& /*num_bytes*/,
+                                 const int64_t& /*timestamp*/) {
+        received_sequence_numbers.push_back(data->at(0));
+        if (received_sequence_numbers.size() == BURST_SIZE * NUMBER_OF_BURSTS)
+        {
+          client_received_data_barrier.release();
+        }
+      }));
+
+  const auto send_burst = [this](const std::size_t& burst) {
+    for (std::size_t i = 0; i < BURST_SIZE; ++i)
+    {
+      mock_udp_server_.asyncSend(host_endpoint, { static_cast<char>(burst * BURST_SIZE + i) });
+    }
+  };
+  // The first burst is already waiting in the socket when the client starts receiving.
+  send_burst(0);
+  udp_client_->startAsyncReceiving(modi);
+  send_burst(1);
+
+  ASSERT_TRUE(client_received_data_barrier.waitTillRelease(DEFAULT_TIMEOUT)) << "Udp client did not receive data";
+  for (std::size_t i = 0; i < BURST_SIZE * NUMBER_OF_BURSTS; ++i)
+  {
+    EXPECT_EQ(static_cast<char>(i), received_sequence_numbers.at(i)) << "Datagram " << i << " received out of order";
+  }
+}
+
+TEST_F(UdpClientBurstTests, shouldReceiveBurstsInOrderInBatchedMode)
+{
+  testReceivingBurstsInOrder(communication_layer::ReceiveMode::continuous_batched);
+}
+
+TEST_F(UdpClientBurstTests, shouldReceiveBurstsInOrderInIoUringMode)
+{
+  testReceivingBurstsInOrder(communication_layer::ReceiveMode::continuous_io_uring);
+}
+
+TEST_F(UdpClientTests, shouldReportMaxBatchSizeInBatchedMode)
+{
+  static constexpr std::size_t BURST_SIZE{ 5 };
+
+  std::size_t number_of_received_datagrams{ 0 };
+  util::Barrier client_received_data_barrier;
+  EXPECT_CALL(*this, handleNewData(_, send_array_.size(), _))
+      .Times(BURST_SIZE)
+      .WillRepeatedly(Invoke([&](const data_conversion_layer::RawDataConstPtr& /*data*/,
+                                 const std::size_t& /*num_bytes*/,
+                                 const int64_t& /*timestamp*/) {
+        if (++number_of_received_datagrams == BURST_SIZE)
+        {
+          client_received_data_barrier.release();
+        }
+      }));
+
+  for (std::size_t i = 0; i < BURST_SIZE; ++i)
+  {
+    sendTestDataToClient();
+  }
+  // The whole burst is waiting in the socket when the client starts receiving.
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  udp_client_->startAsyncReceiving(communication_layer::ReceiveMode::continuous_batched);
+
+  ASSERT_TRUE(client_received_data_barrier.waitTillRelease(DEFAULT_TIMEOUT)) << "Udp client did not receive data";
+  EXPECT_EQ(BURST_SIZE, udp_client_->receiveStatistics().max_batch_size);
+}
+
+TEST_F(UdpClientTests, testErrorHandlingForReceiveInBatchedMode)
+{
+  util::Barrier error_callback_called_barrier;
+  EXPECT_CALL(*this, handleError(_)).WillOnce(OpenBarrier(&error_callback_called_barrier));
+
+  udp_client_->startAsyncReceiving(communication_layer::ReceiveMode::continuous_batched);
+  sendEmptyTestDataToClient();
+  EXPECT_TRUE(error_callback_called_barrier.waitTillRelease(DEFAULT_TIMEOUT))
+      << "Error callback should have been called";
+}
+
+TEST_F(UdpClientTests, testErrorHandlingForReceiveInIoUringMode)
+{
+  util::Barrier error_callback_called_barrier;
+  EXPECT_CALL(*this, handleError(_)).WillOnce(OpenBarrier(&error_callback_called_barrier));
+
+  udp_client_->startAsyncReceiving(communication_layer::ReceiveMode::continuous_io_uring);
+  sendEmptyTestDataToClient();
+  EXPECT_TRUE(error_callback_called_barrier.waitTillRelease(DEFAULT_TIMEOUT))
+      << "Error callback should have been called";
+}
+
+TEST_F(UdpClientTests, shouldReportDatagramsExceedingMaxDatagramSizeInIoUringMode)
+{
+  udp_client_.reset();
+  udp_client_.reset(new communication_layer::UdpClientImpl(std::bind(&UdpClientTests::handleNewData, this, _1, _2, _3),
+                                                           std::bind(&UdpClientTests::handleError, this, _1),
+                                                           HOST_UDP_PORT,
+                                                           util::convertIP(UDP_MOCK_IP_ADDRESS),
+                                                           UDP_MOCK_PORT,
+                                                           send_array_.size() - 1));
+
+  util::Barrier client_received_data_barrier;
+  util::Barrier error_callback_called_barrier;
+  EXPECT_CALL(*this, handleError(_)).WillOnce(OpenBarrier(&error_callback_called_barrier));
+  EXPECT_CALL(*this, handleNewData(_, send_array_.size() - 1, _))
+      .WillOnce(OpenBarrier(&client_received_data_barrier));
+
+  udp_client_->startAsyncReceiving(communication_layer::ReceiveMode::continuous_io_uring);
+  sendTestDataToClient();
+  ASSERT_TRUE(error_callback_called_barrier.waitTillRelease(DEFAULT_TIMEOUT))
+      << "Error callback should have been called";
+  // The next datagram is received completely.
+  mock_udp_server_.asyncSend(host_endpoint, { 'H', 'e', 'l', 'l' });
+  EXPECT_TRUE(client_received_data_barrier.waitTillRelease(DEFAULT_TIMEOUT)) << "Udp client did not receive data";
+}
+
+TEST_F(UdpClientTests, shouldNotReceiveDataAfterStopInIoUringMode)
+{
+  EXPECT_CALL(*this, handleNewData(_, _, _)).Times(0);
+  EXPECT_CALL(*this, handleError(_)).Times(0);
+
+  udp_client_->startAsyncReceiving(communication_layer::ReceiveMode::continuous_io_uring);
+  udp_client_->stop();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  sendTestDataToClient();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  udp_client_.reset();
+}
+
+TEST_F(UdpClientTests, shouldReturnAppliedSocketOptions)
+{
+  const communication_layer::SocketOptions options{
+    communication_layer::SocketOptions().receiveBufferSize(100000).priority(3).dscp(46).enableReceiveErrors()
+  };
+  const communication_layer::SocketOptions applied{ udp_client_->applySocketOptions(options) };
+
+  // The kernel doubles the receive buffer size for its bookkeeping.
+  ASSERT_TRUE(applied.receiveBufferSize());
+  EXPECT_GE(*applied.receiveBufferSize(), *options.receiveBufferSize());
+  EXPECT_EQ(options.priority(), applied.priority());
+  EXPECT_EQ(options.dscp(), applied.dscp());
+  EXPECT_EQ(options.receiveErrorsEnabled(), applied.receiveErrorsEnabled());
+  EXPECT_FALSE(applied.busyPoll()) << "Option not requested must not be applied";
+}
+
+TEST_F(UdpClientTests, shouldApplyThreadSchedulingOnlyToOwnThread)
+{
+  const util::ThreadScheduling scheduling{ util::ThreadScheduling().cpuAffinity({ 0 }) };
+  EXPECT_TRUE(udp_client_->applyThreadScheduling(scheduling));
+
+  communication_layer::IoServiceThreadPool io_service_pool(1);
+  udp_client_.reset();
+  udp_client_.reset(new communication_layer::UdpClientImpl(std::bind(&UdpClientTests::handleNewData, this, _1, _2, _3),
+                                                           std::bind(&UdpClientTests::handleError, this, _1),
+                                                           HOST_UDP_PORT,
+                                                           util::convertIP(UDP_MOCK_IP_ADDRESS),
+                                                           UDP_MOCK_PORT,
+                                                           data_conversion_layer::MAX_UDP_PAKET_SIZE,
+                                                           &io_service_pool.ioService()));
+  EXPECT_FALSE(udp_client_->applyThreadScheduling(scheduling)) << "Threads of a shared io_service must not be changed";
+  EXPECT_TRUE(udp_client_->applyThreadScheduling(util::ThreadScheduling()));
+  udp_client_.reset();
+}
+
+TEST_F(UdpClientTests, shouldReportUnreachablePortIfReceiveErrorsEnabled)
+{
+  static constexpr unsigned short UNUSED_PORT{ UDP_MOCK_PORT + 1 };
+  udp_client_.reset();
+  udp_client_.reset(new communication_layer::UdpClientImpl(std::bind(&UdpClientTests::handleNewData, this, _1, _2, _3),
+                                                           std::bind(&UdpClientTests::handleError, this, _1),
+                                                           HOST_UDP_PORT,
+                                                           util::convertIP(UDP_MOCK_IP_ADDRESS),
+                                                           UNUSED_PORT));
+  ASSERT_EQ(true, udp_client_->applySocketOptions(communication_layer::SocketOptions().enableReceiveErrors())
+                      .receiveErrorsEnabled());
+
+  util::Barrier error_callback_called_barrier;
+  EXPECT_CALL(*this, handleError(_)).WillOnce(OpenBarrier(&error_callback_called_barrier));
+
+  udp_client_->startAsyncReceiving();
+  udp_client_->write(send_array_);
+  EXPECT_TRUE(error_callback_called_barrier.waitTillRelease(DEFAULT_TIMEOUT))
+      << "Error callback should have been called";
+}
+
+TEST_F(UdpClientTests, shouldCountDatagramsDroppedByKernel)
+{
+  static constexpr std::size_t NUMBER_OF_DATAGRAMS{ 200 };
+  static constexpr char LAST_DATAGRAM{ 'z' };
+
+  util::Barrier client_received_last_datagram_barrier;
+  EXPECT_CALL(*this, handleNewData(_, _, _))
+      .WillRepeatedly(Invoke([&](const data_conversion_layer::RawDataConstPtr& data,
+                                 const std::size_t& /*num_bytes*/,
+                                 const int64_t& /*timestamp*/) {
+        if (data->at(0) == LAST_DATAGRAM)
+        {
+          client_received_last_datagram_barrier.release();
+        }
+      }));
+
+  // The kernel limits the receive buffer to its minimal size, which overflows long before all datagrams are sent.
+  udp_client_->applySocketOptions(communication_layer::SocketOptions().receiveBufferSize(1));
+  ASSERT_TRUE(udp_client_->enableKernelDropCounter());
+  for (std::size_t i = 0; i < NUMBER_OF_DATAGRAMS; ++i)
+  {
+    sendTestDataToClient();
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  udp_client_->startAsyncReceiving();
+  // The drop count is attached to datagrams queued after the drops, so one more is needed once the socket was read.
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  mock_udp_server_.asyncSend(host_endpoint, { LAST_DATAGRAM });
+
+  ASSERT_TRUE(client_received_last_datagram_barrier.waitTillRelease(DEFAULT_TIMEOUT))
+      << "Udp client did not receive data";
+  const communication_layer::ReceiveStatistics statistics{ udp_client_->receiveStatistics() };
+  EXPECT_GT(statistics.kernel_drops, 0u);
+  EXPECT_EQ(NUMBER_OF_DATAGRAMS + 1, statistics.datagrams + statistics.kernel_drops);
+}
+
+class UdpClientKernelTimestampTests : public UdpClientTests
+{
+protected:
+  void testStampingWithArrivalTimeInsteadOfDispatchTime(const communication_layer::ReceiveMode& modi);
+};
+
+void UdpClientKernelTimestampTests::testStampingWithArrivalTimeInsteadOfDispatchTime(
+    const communication_layer::ReceiveMode& modi)
+{
+  static constexpr std::chrono::milliseconds BLOCKING_TIME{ 100 };
+
+  std::vector<int64_t> timestamps;
+  std::vector<int64_t> dispatch_times;
+  util::Barrier client_received_data_barrier;
+  EXPECT_CALL(*this, handleNewData(_, 1u, _))
+      .Times(2)
+      .WillRepeatedly(Invoke([&](const data_conversion_layer::RawDataConstPtr& /*data*/,
+                                 const std::size_t& /*num_bytes*/,
+                                 const int64_t& timestamp) {
+        timestamps.push_back(timestamp);
+        dispatch_times.push_back(util::getCurrentTime());
+        if (timestamps.size() == 1)
+        {
+          // Blocks the receiving thread while the second datagram arrives.
+          std::this_thread::sleep_for(BLOCKING_TIME);
+        }
+        else
+        {
+          client_received_data_barrier.release();
+        }
+      }));
+
+  ASSERT_TRUE(udp_client_->enableKernelTimestamps());
+  udp_client_->startAsyncReceiving(modi);
+  const int64_t send_time{ util::getCurrentTime() };
+  mock_udp_server_.asyncSend(host_endpoint, { 'a' });
+  mock_udp_server_.asyncSend(host_endpoint, { 'b' });
+
+  ASSERT_TRUE(client_received_data_barrier.waitTillRelease(DEFAULT_TIMEOUT)) << "Udp client did not receive data";
+  EXPECT_GE(timestamps.at(0), send_time);
+  EXPECT_GE(timestamps.at(1), timestamps.at(0));
+  EXPECT_GE(dispatch_times.at(1) - timestamps.at(1),
+            std::chrono::duration_cast<std::chrono::nanoseconds>(BLOCKING_TIME / 2).count())
+      << "Timestamp contains the time the receiving thread was blocked";
+}
+
+TEST_F(UdpClientKernelTimestampTests, shouldStampDatagramsWithArrivalTimeInContinuousMode)
+{
+  testStampingWithArrivalTimeInsteadOfDispatchTime(communication_layer::ReceiveMode::continuous);
+}
+
+TEST_F(UdpClientKernelTimestampTests, shouldStampDatagramsWithArrivalTimeInBatchedMode)
+{
+  testStampingWithArrivalTimeInsteadOfDispatchTime(communication_layer::ReceiveMode::continuous_batched);
+}
+
+TEST_F(UdpClientKernelTimestampTests, shouldStampDatagramsWithArrivalTimeInIoUringMode)
+{
+  testStampingWithArrivalTimeInsteadOfDispatchTime(communication_layer::ReceiveMode::continuous_io_uring);
+}
+
+TEST_F(UdpClientTests, shouldReceiveSingleDatagramWithKernelTimestamp)
+{
+  util::Barrier client_received_data_barrier;
+  EXPECT_CALL(*this, handleNewData(_, send_array_.size(), _)).WillOnce(OpenBarrier(&client_received_data_barrier));
+
+  ASSERT_TRUE(udp_client_->enableKernelTimestamps());
+  udp_client_->startAsyncReceiving(communication_layer::ReceiveMode::single);
+  sendTestDataToClient();
+  EXPECT_TRUE(client_received_data_barrier.waitTillRelease(DEFAULT_TIMEOUT)) << "Udp client did not receive data";
+}
+
+TEST_F(UdpClientTests, testErrorHandlingForReceiveWithKernelTimestamps)
+{
+  util::Barrier error_callback_called_barrier;
+  EXPECT_CALL(*this, handleError(_)).WillOnce(OpenBarrier(&error_callback_called_barrier));
+
+  ASSERT_TRUE(udp_client_->enableKernelTimestamps());
+  udp_client_->startAsyncReceiving(communication_layer::ReceiveMode::single);
+  sendEmptyTestDataToClient();
+  EXPECT_TRUE(error_callback_called_barrier.waitTillRelease(DEFAULT_TIMEOUT))
+      << "Error callback should have been called";
+}
+#endif
+
 }  // namespace psen_scan_v2_standalone_test
 
 int main(int argc, char* argv[])
@@ -15,6 +15,7 @@
 
 #include <memory>
 #include <stdexcept>
+#include <utility>
 
 #include <gtest/gtest.h>
 
@@ -184,6 +185,119 @@ TEST(LaserScanTest, testSetAndGetIOStates)
   EXPECT_EQ(laser_scan->ioStates()[0].timestamp(), 42);
 }
 
+TEST(LaserScanTest, testSetAndGetSinglePrecisionData)
+{
+  LaserScanBuilder laser_scan_builder;
+  std::unique_ptr<LaserScan> laser_scan;
+  ASSERT_NO_THROW(laser_scan.reset(new LaserScan(laser_scan_builder.build())););
+  EXPECT_FALSE(laser_scan->isSinglePrecision());
+
+  laser_scan->singlePrecisionMeasurements({ 45.f, 44.f });
+  laser_scan->singlePrecisionIntensities({ 1.f, 2.f });
+  EXPECT_TRUE(laser_scan->isSinglePrecision());
+  EXPECT_EQ(LaserScan::SinglePrecisionMeasurementData({ 45.f, 44.f }), laser_scan->singlePrecisionMeasurements());
+  EXPECT_EQ(LaserScan::SinglePrecisionIntensityData({ 1.f, 2.f }), laser_scan->singlePrecisionIntensities());
+}
+
+TEST(LaserScanTest, testSetAndGetRawSamples)
+{
+  LaserScanBuilder laser_scan_builder;
+  std::unique_ptr<LaserScan> laser_scan;
+  ASSERT_NO_THROW(laser_scan.reset(new LaserScan(laser_scan_builder.build())););
+  EXPECT_FALSE(laser_scan->hasRawSamples());
+
+  laser_scan->rawMeasurements({ 4500, 4400 });
+  laser_scan->rawIntensities({ 1, 2 });
+  EXPECT_TRUE(laser_scan->hasRawSamples());
+  EXPECT_EQ(LaserScan::RawMeasurementData({ 4500, 4400 }), laser_scan->rawMeasurements());
+  EXPECT_EQ(LaserScan::RawIntensityData({ 1, 2 }), laser_scan->rawIntensities());
+}
+
+TEST(LaserScanTest, testConstructWithSamples)
+{
+  LaserScan::MeasurementData measurements{ 45.0, 44.0 };
+  LaserScan::IntensityData intensities{ 1.0, 2.0 };
+  LaserScan::IOData io_states{ IOState(createPinData(), 42 /*timestamp*/) };
+  const double* measurements_data{ measurements.data() };
+  const double* intensities_data{ intensities.data() };
+
+  const LaserScan laser_scan(DEFAULT_RESOLUTION,
+                             DEFAULT_MIN_SCAN_ANGLE,
+                             DEFAULT_MAX_SCAN_ANGLE,
+                             DEFAULT_SCAN_COUNTER,
+                             DEFAULT_ACTIVE_ZONESET,
+                             DEFAULT_TIMESTAMP,
+                             DEFAULT_SCANNER_ID,
+                             std::move(measurements),
+                             std::move(intensities),
+                             std::move(io_states));
+
+  EXPECT_EQ(LaserScan::MeasurementData({ 45.0, 44.0 }), laser_scan.measurements());
+  EXPECT_EQ(LaserScan::IntensityData({ 1.0, 2.0 }), laser_scan.intensities());
+  ASSERT_EQ(1u, laser_scan.ioStates().size());
+  EXPECT_EQ(42, laser_scan.ioStates()[0].timestamp());
+  EXPECT_EQ(measurements_data, laser_scan.measurements().data()) << "Measurements were copied";
+  EXPECT_EQ(intensities_data, laser_scan.intensities().data()) << "Intensities were copied";
+}
+
+TEST(LaserScanTest, testConstructWithSamplesShouldValidateAngles)
+{
+  EXPECT_THROW(LaserScan(DEFAULT_RESOLUTION,
+                         DEFAULT_MAX_SCAN_ANGLE,
+                         DEFAULT_MIN_SCAN_ANGLE,
+                         DEFAULT_SCAN_COUNTER,
+                         DEFAULT_ACTIVE_ZONESET,
+                         DEFAULT_TIMESTAMP,
+                         DEFAULT_SCANNER_ID,
+                         LaserScan::MeasurementData{ 45.0, 44.0 }),
+               std::invalid_argument);
+}
+
+TEST(LaserScanTest, testSetSamplesByMoveShouldNotCopy)
+{
+  LaserScan laser_scan{ LaserScanBuilder().build() };
+
+  LaserScan::MeasurementData measurements{ 45.0, 44.0 };
+  const double* measurements_data{ measurements.data() };
+  laser_scan.measurements(std::move(measurements));
+  EXPECT_EQ(measurements_data, laser_scan.measurements().data());
+
+  LaserScan::IntensityData intensities{ 1.0, 2.0 };
+  const double* intensities_data{ intensities.data() };
+  laser_scan.intensities(std::move(intensities));
+  EXPECT_EQ(intensities_data, laser_scan.intensities().data());
+
+  LaserScan::IOData io_states{ IOState(createPinData(), 42 /*timestamp*/) };
+  const IOState* io_states_data{ io_states.data() };
+  laser_scan.ioStates(std::move(io_states));
+  EXPECT_EQ(io_states_data, laser_scan.ioStates().data());
+}
+
+TEST(LaserScanTest, testSetSinglePrecisionAndRawSamplesByMoveShouldNotCopy)
+{
+  LaserScan laser_scan{ LaserScanBuilder().build() };
+
+  LaserScan::SinglePrecisionMeasurementData single_precision_measurements{ 45.f, 44.f };
+  LaserScan::SinglePrecisionIntensityData single_precision_intensities{ 1.f, 2.f };
+  const float* single_precision_measurements_data{ single_precision_measurements.data() };
+  const float* single_precision_intensities_data{ single_precision_intensities.data() };
+  laser_scan.singlePrecisionMeasurements(std::move(single_precision_measurements));
+  laser_scan.singlePrecisionIntensities(std::move(single_precision_intensities));
+  EXPECT_TRUE(laser_scan.isSinglePrecision());
+  EXPECT_EQ(single_precision_measurements_data, laser_scan.singlePrecisionMeasurements().data());
+  EXPECT_EQ(single_precision_intensities_data, laser_scan.singlePrecisionIntensities().data());
+
+  LaserScan::RawMeasurementData raw_measurements{ 4500, 4400 };
+  LaserScan::RawIntensityData raw_intensities{ 1, 2 };
+  const uint16_t* raw_measurements_data{ raw_measurements.data() };
+  const uint16_t* raw_intensities_data{ raw_intensities.data() };
+  laser_scan.rawMeasurements(std::move(raw_measurements));
+  laser_scan.rawIntensities(std::move(raw_intensities));
+  EXPECT_TRUE(laser_scan.hasRawSamples());
+  EXPECT_EQ(raw_measurements_data, laser_scan.rawMeasurements().data());
+  EXPECT_EQ(raw_intensities_data, laser_scan.rawIntensities().data());
+}
+
 TEST(LaserScanTest, testPrintMessageSuccess)
 {
   LaserScanBuilder laser_scan_builder;
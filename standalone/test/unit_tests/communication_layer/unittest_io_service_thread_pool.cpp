@@ -0,0 +1,80 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/communication_layer/io_service_thread_pool.h"
+#include "psen_scan_v2_standalone/util/async_barrier.h"
+
+using namespace psen_scan_v2_standalone;
+using communication_layer::IoServiceThreadPool;
+
+namespace psen_scan_v2_standalone_test
+{
+static constexpr std::chrono::seconds DEFAULT_TIMEOUT{ 5 };
+
+TEST(IoServiceThreadPoolTest, shouldThrowInvalidArgumentWithoutThreads)
+{
+  EXPECT_THROW(IoServiceThreadPool pool(0), std::invalid_argument);
+}
+
+TEST(IoServiceThreadPoolTest, shouldReturnNumberOfThreads)
+{
+  const IoServiceThreadPool pool(3);
+  EXPECT_EQ(3u, pool.numberOfThreads());
+}
+
+TEST(IoServiceThreadPoolTest, shouldRunHandlersInAllThreads)
+{
+  static constexpr std::size_t NUMBER_OF_THREADS{ 2 };
+  IoServiceThreadPool pool(NUMBER_OF_THREADS);
+
+  // Each handler blocks until a handler ran in every thread, so the handlers cannot share one thread.
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> thread_ids;
+  util::Barrier all_threads_used_barrier;
+  for (std::size_t i = 0; i < NUMBER_OF_THREADS; ++i)
+  {
+    pool.ioService().post([&]() {
+      {
+        std::lock_guard<std::mutex> lock(thread_ids_mutex);
+        thread_ids.insert(std::this_thread::get_id());
+        if (thread_ids.size() == NUMBER_OF_THREADS)
+        {
+          all_threads_used_barrier.release();
+        }
+      }
+      all_threads_used_barrier.waitTillRelease(DEFAULT_TIMEOUT);
+    });
+  }
+
+  ASSERT_TRUE(all_threads_used_barrier.waitTillRelease(DEFAULT_TIMEOUT)) << "Handlers were not run in parallel";
+  EXPECT_EQ(0u, thread_ids.count(std::this_thread::get_id()));
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,169 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/communication_layer/io_uring_receiver.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+
+#ifdef PSEN_SCAN_V2_STANDALONE_IO_URING_SUPPORTED
+#include <poll.h>
+
+using namespace psen_scan_v2_standalone;
+using boost::asio::ip::udp;
+using communication_layer::IoUringReceiver;
+
+namespace psen_scan_v2_standalone_test
+{
+static constexpr std::size_t MAX_DATAGRAM_SIZE{ 16 };
+static constexpr std::size_t CONTROL_BUFFER_SIZE{ 64 };
+static constexpr std::chrono::milliseconds DEFAULT_TIMEOUT{ 5000 };
+
+struct ReceivedDatagram
+{
+  data_conversion_layer::RawDataPtr data;
+  std::size_t bytes_received;
+};
+
+class IoUringReceiverTest : public testing::Test
+{
+protected:
+  void SetUp() override;
+  void send(const std::string& payload);
+  //! @brief Waits until the receiver has completions and processes them.
+  std::size_t processCompletions();
+
+protected:
+  boost::asio::io_service io_service_;
+  udp::socket receiving_socket_{ io_service_, udp::endpoint(boost::asio::ip::address_v4::loopback(), 0) };
+  udp::socket sending_socket_{ io_service_, udp::endpoint(boost::asio::ip::address_v4::loopback(), 0) };
+  std::unique_ptr<IoUringReceiver> receiver_;
+  std::vector<ReceivedDatagram> received_datagrams_;
+  std::vector<int> errors_;
+};
+
+void IoUringReceiverTest::SetUp()
+{
+  try
+  {
+    receiver_.reset(new IoUringReceiver(receiving_socket_.native_handle(), MAX_DATAGRAM_SIZE, CONTROL_BUFFER_SIZE, 4));
+  }
+  catch (const IoUringReceiver::SetupFailure& ex)
+  {
+    GTEST_SKIP() << "io_uring is not available: " << ex.what();
+  }
+}
+
+void IoUringReceiverTest::send(const std::string& payload)
+{
+  sending_socket_.send_to(boost::asio::buffer(payload), receiving_socket_.local_endpoint());
+}
+
+std::size_t IoUringReceiverTest::processCompletions()
+{
+  pollfd ring{ receiver_->fd(), POLLIN, 0 };
+  if (!receiver_->completionsPending() && ::poll(&ring, 1, static_cast<int>(DEFAULT_TIMEOUT.count())) != 1)
+  {
+    return 0;
+  }
+  return receiver_->processCompletions(
+      [this](const data_conversion_layer::RawDataPtr& data, const std::size_t& bytes_received, msghdr& /*control*/) {
+        received_datagrams_.push_back(ReceivedDatagram{ data, bytes_received });
+      },
+      [this](const int& error_number) { errors_.push_back(error_number); });
+}
+
+TEST(IoUringReceiverConstructionTest, shouldThrowInvalidArgumentIfNumberOfBuffersIsNoPowerOfTwo)
+{
+  EXPECT_THROW(IoUringReceiver receiver(-1, MAX_DATAGRAM_SIZE, CONTROL_BUFFER_SIZE, 0), std::invalid_argument);
+  EXPECT_THROW(IoUringReceiver receiver(-1, MAX_DATAGRAM_SIZE, CONTROL_BUFFER_SIZE, 3), std::invalid_argument);
+  EXPECT_THROW(
+      IoUringReceiver receiver(-1, MAX_DATAGRAM_SIZE, CONTROL_BUFFER_SIZE, 2 * IoUringReceiver::MAX_NUMBER_OF_BUFFERS),
+      std::invalid_argument);
+}
+
+TEST_F(IoUringReceiverTest, shouldPassOnDatagramsWithPayloadAtBeginningOfBuffer)
+{
+  receiver_->start();
+  send("Hello");
+  send("io_uring");
+
+  while (received_datagrams_.size() < 2 && processCompletions() > 0)
+  {
+  }
+  ASSERT_EQ(2u, received_datagrams_.size());
+  EXPECT_EQ("Hello", std::string(received_datagrams_[0].data->data(), received_datagrams_[0].bytes_received));
+  EXPECT_EQ("io_uring", std::string(received_datagrams_[1].data->data(), received_datagrams_[1].bytes_received));
+  EXPECT_TRUE(errors_.empty());
+}
+
+TEST_F(IoUringReceiverTest, shouldNotReuseBuffersStillHeldByConsumer)
+{
+  receiver_->start();
+  // More datagrams than buffers registered with the kernel.
+  static constexpr std::size_t NUMBER_OF_DATAGRAMS{ 10 };
+  for (std::size_t i = 0; i < NUMBER_OF_DATAGRAMS; ++i)
+  {
+    send(std::to_string(i));
+    ASSERT_EQ(1u, processCompletions());
+  }
+
+  for (std::size_t i = 0; i < NUMBER_OF_DATAGRAMS; ++i)
+  {
+    EXPECT_EQ(std::to_string(i),
+              std::string(received_datagrams_[i].data->data(), received_datagrams_[i].bytes_received));
+  }
+}
+
+TEST_F(IoUringReceiverTest, shouldPassOnTruncatedDatagramsWithMoreThanMaxDatagramSize)
+{
+  receiver_->start();
+  const std::string too_large_payload(2 * MAX_DATAGRAM_SIZE, 'x');
+  send(too_large_payload);
+
+  ASSERT_EQ(1u, processCompletions());
+  EXPECT_EQ(MAX_DATAGRAM_SIZE + 1, received_datagrams_.at(0).bytes_received);
+}
+
+TEST_F(IoUringReceiverTest, shouldStopReceivingWhenCanceled)
+{
+  receiver_->start();
+  ASSERT_TRUE(receiver_->receiving());
+  receiver_->cancel();
+  send("Hello");
+
+  processCompletions();
+  EXPECT_FALSE(receiver_->receiving());
+  EXPECT_TRUE(received_datagrams_.empty());
+  EXPECT_TRUE(errors_.empty());
+}
+
+}  // namespace psen_scan_v2_standalone_test
+#endif
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,131 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/communication_layer/receive_buffer_pool.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+
+using namespace psen_scan_v2_standalone;
+using communication_layer::ReceiveBufferPool;
+
+namespace psen_scan_v2_standalone_test
+{
+static constexpr std::size_t NUMBER_OF_BUFFERS{ 3 };
+static constexpr std::size_t BUFFER_SIZE{ 100 };
+
+TEST(ReceiveBufferPoolTest, shouldProvideBuffersOfConfiguredSize)
+{
+  const auto pool{ ReceiveBufferPool::create(NUMBER_OF_BUFFERS, BUFFER_SIZE) };
+  EXPECT_EQ(NUMBER_OF_BUFFERS, pool->numberOfBuffers());
+  EXPECT_EQ(NUMBER_OF_BUFFERS, pool->numberOfFreeBuffers());
+  EXPECT_EQ(BUFFER_SIZE, pool->bufferSize());
+  EXPECT_EQ(BUFFER_SIZE, pool->acquire()->size());
+}
+
+TEST(ReceiveBufferPoolTest, shouldRecycleBufferAfterLastReferenceIsReleased)
+{
+  const auto pool{ ReceiveBufferPool::create(NUMBER_OF_BUFFERS, BUFFER_SIZE) };
+  auto buffer{ pool->acquire() };
+  const data_conversion_layer::RawData* buffer_memory{ buffer.get() };
+  EXPECT_EQ(NUMBER_OF_BUFFERS - 1, pool->numberOfFreeBuffers());
+
+  data_conversion_layer::RawDataConstPtr copy{ buffer };
+  buffer.reset();
+  EXPECT_EQ(NUMBER_OF_BUFFERS - 1, pool->numberOfFreeBuffers()) << "Buffer recycled while still referenced";
+
+  copy.reset();
+  EXPECT_EQ(NUMBER_OF_BUFFERS, pool->numberOfFreeBuffers());
+  EXPECT_EQ(buffer_memory, pool->acquire().get());
+}
+
+TEST(ReceiveBufferPoolTest, shouldNotModifyBufferWhileReferenced)
+{
+  const auto pool{ ReceiveBufferPool::create(NUMBER_OF_BUFFERS, BUFFER_SIZE) };
+  const data_conversion_layer::RawDataPtr kept_buffer{ pool->acquire() };
+  std::fill(kept_buffer->begin(), kept_buffer->end(), 'a');
+
+  for (std::size_t i = 0; i < 2 * NUMBER_OF_BUFFERS; ++i)
+  {
+    const auto buffer{ pool->acquire() };
+    EXPECT_NE(kept_buffer.get(), buffer.get());
+    std::fill(buffer->begin(), buffer->end(), 'b');
+  }
+  EXPECT_TRUE(std::all_of(kept_buffer->begin(), kept_buffer->end(), [](char c) { return c == 'a'; }));
+}
+
+TEST(ReceiveBufferPoolTest, shouldAllocateNewBufferIfAllBuffersAreInUse)
+{
+  const auto pool{ ReceiveBufferPool::create(NUMBER_OF_BUFFERS, BUFFER_SIZE) };
+  std::vector<data_conversion_layer::RawDataPtr> buffers;
+  for (std::size_t i = 0; i < NUMBER_OF_BUFFERS + 1; ++i)
+  {
+    buffers.push_back(pool->acquire());
+  }
+  EXPECT_EQ(0u, pool->numberOfFreeBuffers());
+  EXPECT_EQ(BUFFER_SIZE, buffers.back()->size());
+
+  buffers.clear();
+  EXPECT_EQ(NUMBER_OF_BUFFERS, pool->numberOfFreeBuffers()) << "Allocated buffer must not be added to the pool";
+}
+
+TEST(ReceiveBufferPoolTest, shouldKeepBufferValidAfterPoolIsReleased)
+{
+  auto pool{ ReceiveBufferPool::create(NUMBER_OF_BUFFERS, BUFFER_SIZE) };
+  const std::weak_ptr<ReceiveBufferPool> weak_pool{ pool };
+  const data_conversion_layer::RawDataPtr buffer{ pool->acquire() };
+  std::fill(buffer->begin(), buffer->end(), 'a');
+
+  pool.reset();
+  EXPECT_FALSE(weak_pool.expired()) << "The pool has to be kept alive by its buffers";
+  EXPECT_TRUE(std::all_of(buffer->begin(), buffer->end(), [](char c) { return c == 'a'; }));
+}
+
+TEST(ReceiveBufferPoolTest, shouldReleasePoolAfterLastBuffer)
+{
+  auto pool{ ReceiveBufferPool::create(NUMBER_OF_BUFFERS, BUFFER_SIZE) };
+  const std::weak_ptr<ReceiveBufferPool> weak_pool{ pool };
+  data_conversion_layer::RawDataPtr buffer{ pool->acquire() };
+
+  pool.reset();
+  buffer.reset();
+  EXPECT_TRUE(weak_pool.expired());
+}
+
+TEST(ReceiveBufferPoolTest, shouldRecycleBuffersReleasedOnOtherThread)
+{
+  const auto pool{ ReceiveBufferPool::create(NUMBER_OF_BUFFERS, BUFFER_SIZE) };
+  for (std::size_t i = 0; i < 100; ++i)
+  {
+    data_conversion_layer::RawDataConstPtr buffer{ pool->acquire() };
+    std::thread consumer([buffer]() mutable { buffer.reset(); });
+    buffer.reset();
+    consumer.join();
+  }
+  EXPECT_EQ(NUMBER_OF_BUFFERS, pool->numberOfFreeBuffers());
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,74 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <chrono>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/communication_layer/socket_options.h"
+
+using namespace psen_scan_v2_standalone;
+using communication_layer::SocketOptions;
+
+namespace psen_scan_v2_standalone_test
+{
+TEST(SocketOptionsTest, shouldNotSetAnyOptionByDefault)
+{
+  const SocketOptions options;
+  EXPECT_FALSE(options.receiveBufferSize());
+  EXPECT_FALSE(options.busyPoll());
+  EXPECT_FALSE(options.priority());
+  EXPECT_FALSE(options.dscp());
+  EXPECT_FALSE(options.receiveErrorsEnabled());
+}
+
+TEST(SocketOptionsTest, shouldReturnSetOptions)
+{
+  const SocketOptions options{
+    SocketOptions().receiveBufferSize(1 << 20).busyPoll(std::chrono::microseconds(50)).priority(4).dscp(46)
+  };
+  EXPECT_EQ(1 << 20, options.receiveBufferSize().value());
+  EXPECT_EQ(50, options.busyPoll().value().count());
+  EXPECT_EQ(4, options.priority().value());
+  EXPECT_EQ(46, options.dscp().value());
+  EXPECT_FALSE(options.receiveErrorsEnabled());
+  EXPECT_TRUE(SocketOptions().enableReceiveErrors().receiveErrorsEnabled().value());
+}
+
+TEST(SocketOptionsTest, shouldThrowInvalidArgumentOnInvalidValues)
+{
+  SocketOptions options;
+  EXPECT_THROW(options.receiveBufferSize(0), std::invalid_argument);
+  EXPECT_THROW(options.busyPoll(std::chrono::microseconds(-1)), std::invalid_argument);
+  EXPECT_THROW(options.priority(-1), std::invalid_argument);
+  EXPECT_THROW(options.dscp(SocketOptions::MAX_DSCP + 1), std::invalid_argument);
+  EXPECT_EQ(SocketOptions(), options);
+}
+
+TEST(SocketOptionsTest, shouldCompareAllOptions)
+{
+  EXPECT_EQ(SocketOptions().dscp(46), SocketOptions().dscp(46));
+  EXPECT_NE(SocketOptions().dscp(46), SocketOptions().dscp(10));
+  EXPECT_NE(SocketOptions().enableReceiveErrors(false), SocketOptions());
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -23,6 +23,7 @@
 
 #include "psen_scan_v2_standalone/data_conversion_layer/angle_conversions.h"
 #include "psen_scan_v2_standalone/configuration/default_parameters.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
 #include "psen_scan_v2_standalone/util/ip_conversion.h"
 #include "psen_scan_v2_standalone/util/tenth_of_degree.h"
 #include "psen_scan_v2_standalone/scanner_configuration.h"
@@ -316,6 +317,158 @@ TEST_F(ScannerConfigurationTest, shouldThrowInvalidArgumentWithResolutionViolati
   EXPECT_THROW(sb.scanResolution(util::TenthOfDegree{ 101u }), std::invalid_argument);
 }
 
+TEST_F(ScannerConfigurationTest, shouldDecodeAllFieldsByDefault)
+{
+  const ScannerConfiguration sc{ createValidDefaultConfig() };
+  EXPECT_EQ(data_conversion_layer::monitoring_frame::DecodeOptions(), sc.decodeOptions());
+}
+
+TEST_F(ScannerConfigurationTest, shouldAlwaysDecodeFieldsRequiredForLaserScan)
+{
+  using data_conversion_layer::monitoring_frame::DecodeField;
+  using data_conversion_layer::monitoring_frame::DecodeOptions;
+
+  const ScannerConfiguration sc{ ScannerConfigurationBuilder(VALID_IP)
+                                     .scanRange(SCAN_RANGE)
+                                     .decodeOptions(DecodeOptions::none().with(DecodeField::io_pin_data))
+                                     .build() };
+  EXPECT_TRUE(sc.decodeOptions().decodes(DecodeField::scan_counter));
+  EXPECT_TRUE(sc.decodeOptions().decodes(DecodeField::zoneset));
+  EXPECT_TRUE(sc.decodeOptions().decodes(DecodeField::measurements));
+  EXPECT_TRUE(sc.decodeOptions().decodes(DecodeField::io_pin_data));
+  EXPECT_FALSE(sc.decodeOptions().decodes(DecodeField::intensities));
+  EXPECT_FALSE(sc.decodeOptions().decodes(DecodeField::diagnostics));
+}
+
+TEST_F(ScannerConfigurationTest, shouldDecodeInDoublePrecisionByDefault)
+{
+  const ScannerConfiguration sc{ createValidDefaultConfig() };
+  EXPECT_FALSE(sc.singlePrecisionEnabled());
+  EXPECT_FALSE(sc.decodeOptions().singlePrecision());
+}
+
+TEST_F(ScannerConfigurationTest, shouldDecodeInSinglePrecisionIfEnabled)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).enableSinglePrecision().build()
+  };
+  EXPECT_TRUE(sc.singlePrecisionEnabled());
+  EXPECT_TRUE(sc.decodeOptions().singlePrecision());
+}
+
+TEST_F(ScannerConfigurationTest, shouldKeepRawSamplesIfEnabled)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).enableRawSamples().build()
+  };
+  EXPECT_TRUE(sc.rawSamplesEnabled());
+  EXPECT_TRUE(sc.decodeOptions().rawSamples());
+  EXPECT_FALSE(createValidDefaultConfig().decodeOptions().rawSamples());
+}
+
+TEST_F(ScannerConfigurationTest, shouldReceiveBatchedIfEnabled)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).enableBatchedReceive().build()
+  };
+  EXPECT_TRUE(sc.batchedReceiveEnabled());
+  EXPECT_FALSE(createValidDefaultConfig().batchedReceiveEnabled());
+}
+
+TEST_F(ScannerConfigurationTest, shouldReceiveViaIoUringIfEnabled)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).enableIoUringReceive().build()
+  };
+  EXPECT_TRUE(sc.ioUringReceiveEnabled());
+  EXPECT_FALSE(createValidDefaultConfig().ioUringReceiveEnabled());
+}
+
+TEST_F(ScannerConfigurationTest, shouldStampInKernelIfEnabled)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).enableKernelTimestamps().build()
+  };
+  EXPECT_TRUE(sc.kernelTimestampsEnabled());
+  EXPECT_FALSE(createValidDefaultConfig().kernelTimestampsEnabled());
+}
+
+TEST_F(ScannerConfigurationTest, shouldReturnSetSocketOptions)
+{
+  const auto data_socket_options{ communication_layer::SocketOptions().receiveBufferSize(1 << 20) };
+  const auto control_socket_options{ communication_layer::SocketOptions().priority(6).dscp(46) };
+  const ScannerConfiguration sc{ ScannerConfigurationBuilder(VALID_IP)
+                                     .scanRange(SCAN_RANGE)
+                                     .dataSocketOptions(data_socket_options)
+                                     .controlSocketOptions(control_socket_options)
+                                     .build() };
+  EXPECT_EQ(data_socket_options, sc.dataSocketOptions());
+  EXPECT_EQ(control_socket_options, sc.controlSocketOptions());
+  EXPECT_EQ(communication_layer::SocketOptions(), createValidDefaultConfig().dataSocketOptions());
+}
+
+TEST_F(ScannerConfigurationTest, shouldReturnSetNetworkThreadScheduling)
+{
+  const auto scheduling{ util::ThreadScheduling().cpuAffinity({ 2 }).realtime(util::SchedulingPolicy::fifo, 50) };
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).networkThreadScheduling(scheduling).build()
+  };
+  EXPECT_EQ(scheduling, sc.networkThreadScheduling());
+  EXPECT_EQ(util::ThreadScheduling(), createValidDefaultConfig().networkThreadScheduling());
+}
+
+TEST_F(ScannerConfigurationTest, shouldDeriveMaxFrameSizeFromResolutionAndIntensities)
+{
+  const ScannerConfiguration sc{ ScannerConfigurationBuilder(VALID_IP)
+                                     .scanRange(SCAN_RANGE)
+                                     .scanResolution(SCAN_RESOLUTION)
+                                     .enableIntensities(true)
+                                     .build() };
+  EXPECT_EQ(data_conversion_layer::monitoring_frame::maxFrameSize(SCAN_RESOLUTION, true), sc.maxFrameSize());
+  EXPECT_LT(sc.maxFrameSize(), data_conversion_layer::MAX_UDP_PAKET_SIZE);
+}
+
+TEST_F(ScannerConfigurationTest, shouldReturnSetMaxFrameSize)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).maxFrameSize(1000).build()
+  };
+  EXPECT_EQ(1000u, sc.maxFrameSize());
+}
+
+TEST_F(ScannerConfigurationTest, shouldThrowInvalidArgumentWithMaxFrameSizeOutOfRange)
+{
+  ScannerConfigurationBuilder sb(VALID_IP);
+  EXPECT_THROW(sb.maxFrameSize(0), std::invalid_argument);
+  EXPECT_THROW(sb.maxFrameSize(data_conversion_layer::MAX_UDP_PAKET_SIZE + 1), std::invalid_argument);
+  EXPECT_NO_THROW(sb.maxFrameSize(data_conversion_layer::MAX_UDP_PAKET_SIZE));
+}
+
+TEST_F(ScannerConfigurationTest, shouldReturnSetScanRoundReorderWindow)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).scanRoundReorderWindow(2).build()
+  };
+  EXPECT_EQ(2u, sc.scanRoundReorderWindow());
+  EXPECT_EQ(0u, createValidDefaultConfig().scanRoundReorderWindow());
+}
+
+TEST_F(ScannerConfigurationTest, shouldThrowInvalidArgumentWithScanRoundReorderWindowOutOfRange)
+{
+  ScannerConfigurationBuilder sb(VALID_IP);
+  EXPECT_THROW(sb.scanRoundReorderWindow(configuration::MAX_SCAN_ROUND_REORDER_WINDOW + 1), std::invalid_argument);
+  EXPECT_NO_THROW(sb.scanRoundReorderWindow(configuration::MAX_SCAN_ROUND_REORDER_WINDOW));
+}
+
+TEST_F(ScannerConfigurationTest, shouldReturnSetPartialScans)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).enablePartialScans().build()
+  };
+  EXPECT_TRUE(sc.partialScansEnabled());
+  EXPECT_FALSE(createValidDefaultConfig().partialScansEnabled());
+}
+
 }  // namespace psen_scan_v2_standalone_test
 
 int main(int argc, char* argv[])
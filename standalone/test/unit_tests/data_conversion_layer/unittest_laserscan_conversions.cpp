@@ -14,6 +14,7 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <memory>
 
@@ -180,6 +181,50 @@ TEST(LaserScanConversionsTest, laserScanShouldContainCorrectIntensitiesAfterConv
   EXPECT_THAT(scan_ptr->intensities(), PointwiseDoubleEq(stamped_msg.msg_.intensities()));
 }
 
+TEST(LaserScanConversionsTest, laserScanShouldContainSinglePrecisionDataIfFramesAreSinglePrecision)
+{
+  const auto stamped_msg{ MessageStamped(MessageBuilder()
+                                             .fromTheta(util::TenthOfDegree{ 10 })
+                                             .resolution(util::TenthOfDegree{ 2 })
+                                             .scanCounter(42)
+                                             .activeZoneset(0)
+                                             .singlePrecisionMeasurements({ 1.f, 2.f, 4.5f })
+                                             .singlePrecisionIntensities({ 0.f, 1007.f, 14000.f }),
+                                         DEFAULT_TIMESTAMP) };
+
+  std::unique_ptr<LaserScan> scan_ptr;
+  ASSERT_NO_THROW(
+      scan_ptr.reset(new LaserScan{ data_conversion_layer::LaserScanConverter::toLaserScan({ stamped_msg }) }););
+
+  EXPECT_TRUE(scan_ptr->isSinglePrecision());
+  EXPECT_TRUE(scan_ptr->measurements().empty());
+  EXPECT_EQ(stamped_msg.msg_.singlePrecisionMeasurements(), scan_ptr->singlePrecisionMeasurements());
+  EXPECT_EQ(stamped_msg.msg_.singlePrecisionIntensities(), scan_ptr->singlePrecisionIntensities());
+  EXPECT_EQ(util::TenthOfDegree{ 14 }, scan_ptr->maxScanAngle());
+}
+
+TEST(LaserScanConversionsTest, laserScanShouldContainRawSamplesIfFramesContainRawSamples)
+{
+  const auto stamped_msg{ MessageStamped(MessageBuilder()
+                                             .fromTheta(util::TenthOfDegree{ 10 })
+                                             .resolution(util::TenthOfDegree{ 2 })
+                                             .scanCounter(42)
+                                             .activeZoneset(0)
+                                             .rawMeasurements({ 1000, 2000, 59956 })
+                                             .rawIntensities({ 0, 1007, 0b1100000000000001 }),
+                                         DEFAULT_TIMESTAMP) };
+
+  std::unique_ptr<LaserScan> scan_ptr;
+  ASSERT_NO_THROW(
+      scan_ptr.reset(new LaserScan{ data_conversion_layer::LaserScanConverter::toLaserScan({ stamped_msg }) }););
+
+  EXPECT_TRUE(scan_ptr->hasRawSamples());
+  EXPECT_TRUE(scan_ptr->measurements().empty());
+  EXPECT_EQ(stamped_msg.msg_.rawMeasurements(), scan_ptr->rawMeasurements());
+  EXPECT_EQ(stamped_msg.msg_.rawIntensities(), scan_ptr->rawIntensities());
+  EXPECT_EQ(util::TenthOfDegree{ 14 }, scan_ptr->maxScanAngle());
+}
+
 TEST(LaserScanConversionsTest, laserScanShouldContainCorrectScanCounterAfterConversion)
 {
   const auto stamped_msg{ createDefaultStampedMsg() };
@@ -253,6 +298,83 @@ TEST(LaserScanConversionsTest, shouldThrowProtocolErrorOnMismatchingScanCounters
                data_conversion_layer::ScannerProtocolViolationError);
 }
 
+TEST(LaserScanConversionsTest, tryToLaserScanShouldReturnStatusOnMissingFrames)
+{
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(data_conversion_layer::ScanConversionStatus::no_frames,
+            data_conversion_layer::LaserScanConverter::tryToLaserScan({}, scan));
+  EXPECT_FALSE(scan.is_initialized());
+}
+
+TEST(LaserScanConversionsTest, tryToLaserScanShouldReturnStatusOnMismatchingScanCounters)
+{
+  auto stamped_msgs = createValidStampedMsgs(2);
+  ADD_OFFSET_TO_SCALAR_MSG_PROPERTY(stamped_msgs[1].msg_, scanCounter, 1);
+
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(data_conversion_layer::ScanConversionStatus::scan_counters_mismatch,
+            data_conversion_layer::LaserScanConverter::tryToLaserScan(stamped_msgs, scan));
+  EXPECT_FALSE(scan.is_initialized());
+}
+
+TEST(LaserScanConversionsTest, tryToLaserScanShouldReturnStatusOnZeroResolution)
+{
+  const std::vector<MessageStamped> stamped_msgs{ MessageStamped(
+      createDefaultMsgBuilder().resolution(util::TenthOfDegree{ 0 }), DEFAULT_TIMESTAMP) };
+
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(data_conversion_layer::ScanConversionStatus::invalid_resolution,
+            data_conversion_layer::LaserScanConverter::tryToLaserScan(stamped_msgs, scan));
+  EXPECT_FALSE(scan.is_initialized());
+}
+
+TEST(LaserScanConversionsTest, tryToLaserScanShouldReturnStatusOnNegativeResolution)
+{
+  auto stamped_msgs = createValidStampedMsgs(2);
+  for (auto& stamped_msg : stamped_msgs)
+  {
+    stamped_msg.msg_ = createDefaultMsgBuilder()
+                           .fromTheta(stamped_msg.msg_.fromTheta())
+                           .resolution(util::TenthOfDegree{ -2 });
+  }
+
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(data_conversion_layer::ScanConversionStatus::invalid_resolution,
+            data_conversion_layer::LaserScanConverter::tryToLaserScan(stamped_msgs, scan));
+  EXPECT_FALSE(scan.is_initialized());
+}
+
+TEST(LaserScanConversionsTest, tryToLaserScanShouldReturnStatusOnOverlappingFramesLeavingAGap)
+{
+  auto stamped_msgs = createValidStampedMsgs(3);
+  // The second frame overlaps the first one by two samples, which leaves a gap of two samples before the third one.
+  ADD_OFFSET_TO_SCALAR_MSG_PROPERTY(stamped_msgs[1].msg_, fromTheta, util::TenthOfDegree{ -4 });
+
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(data_conversion_layer::ScanConversionStatus::theta_angles_mismatch,
+            data_conversion_layer::LaserScanConverter::tryToLaserScan(stamped_msgs, scan));
+  EXPECT_FALSE(scan.is_initialized());
+}
+
+TEST(LaserScanConversionsTest, laserScanShouldOnlyContainIntensitiesIfAllFramesHaveIntensities)
+{
+  auto stamped_msgs = createValidStampedMsgs(2);
+  stamped_msgs[1].msg_ = createDefaultMsgBuilder().fromTheta(stamped_msgs[1].msg_.fromTheta()).intensities({});
+
+  const auto scan = data_conversion_layer::LaserScanConverter::toLaserScan(stamped_msgs);
+  EXPECT_EQ(2 * stamped_msgs[0].msg_.numberOfMeasurements(), scan.measurements().size());
+  EXPECT_TRUE(scan.intensities().empty());
+}
+
+TEST(LaserScanConversionsTest, tryToLaserScanShouldReturnOkAndScanForValidFrames)
+{
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(data_conversion_layer::ScanConversionStatus::ok,
+            data_conversion_layer::LaserScanConverter::tryToLaserScan(createValidStampedMsgs(2), scan));
+  ASSERT_TRUE(scan.is_initialized());
+  EXPECT_EQ(42u, scan->scanCounter());
+}
+
 TEST(LaserScanConversionsTest, laserScanShouldContainAllScanInformationWhenBuildWithMultipleFrames)
 {
   auto stamped_msgs = createValidStampedMsgs(6);
@@ -381,6 +503,196 @@ TEST(LaserScanConversionsTest, conversionShouldIgnoreEmptyFramesForTimestampsCom
   EXPECT_EQ(expected_stamp, scan_ptr->timestamp());
 }
 
+///////////////////////////////////////
+//  Test Cases with Partial Scans    //
+///////////////////////////////////////
+
+TEST(LaserScanConversionsTest, partialScanShouldFillGapBetweenFramesWithNaN)
+{
+  auto stamped_msgs = createValidStampedMsgs(3);
+  const std::size_t samples_per_msg{ stamped_msgs[0].msg_.measurements().size() };
+  stamped_msgs.erase(stamped_msgs.begin() + 1);
+
+  boost::optional<LaserScan> scan;
+  ASSERT_EQ(data_conversion_layer::ScanConversionStatus::ok,
+            data_conversion_layer::LaserScanConverter::tryToPartialLaserScan(stamped_msgs, boost::none, scan));
+
+  EXPECT_TRUE(scan->isPartial());
+  EXPECT_EQ(samples_per_msg, scan->numberOfMissingMeasurements());
+  EXPECT_EQ(util::TenthOfDegree{ 10 }, scan->minScanAngle());
+  EXPECT_EQ(util::TenthOfDegree{ 50 }, scan->maxScanAngle());
+  ASSERT_EQ(3 * samples_per_msg, scan->measurements().size());
+  ASSERT_EQ(3 * samples_per_msg, scan->intensities().size());
+  for (std::size_t i = 0; i < samples_per_msg; ++i)
+  {
+    EXPECT_DOUBLE_EQ(stamped_msgs[0].msg_.measurements()[i], scan->measurements()[i]);
+    EXPECT_TRUE(std::isnan(scan->measurements()[samples_per_msg + i]));
+    EXPECT_TRUE(std::isnan(scan->intensities()[samples_per_msg + i]));
+    EXPECT_DOUBLE_EQ(stamped_msgs[1].msg_.measurements()[i], scan->measurements()[2 * samples_per_msg + i]);
+  }
+}
+
+TEST(LaserScanConversionsTest, partialScanShouldPlaceFramesReceivedInReverseOrder)
+{
+  auto stamped_msgs = createValidStampedMsgs(4);
+  const std::size_t samples_per_msg{ stamped_msgs[0].msg_.measurements().size() };
+  stamped_msgs.erase(stamped_msgs.begin() + 1);
+  std::reverse(stamped_msgs.begin(), stamped_msgs.end());
+
+  boost::optional<LaserScan> scan;
+  ASSERT_EQ(data_conversion_layer::ScanConversionStatus::ok,
+            data_conversion_layer::LaserScanConverter::tryToPartialLaserScan(stamped_msgs, boost::none, scan));
+
+  ASSERT_EQ(4 * samples_per_msg, scan->measurements().size());
+  EXPECT_EQ(samples_per_msg, scan->numberOfMissingMeasurements());
+  for (std::size_t i = 0; i < samples_per_msg; ++i)
+  {
+    EXPECT_DOUBLE_EQ(stamped_msgs[2].msg_.measurements()[i], scan->measurements()[i]);
+    EXPECT_TRUE(std::isnan(scan->measurements()[samples_per_msg + i]));
+    EXPECT_DOUBLE_EQ(stamped_msgs[1].msg_.measurements()[i], scan->measurements()[2 * samples_per_msg + i]);
+    EXPECT_DOUBLE_EQ(stamped_msgs[0].msg_.measurements()[i], scan->measurements()[3 * samples_per_msg + i]);
+  }
+}
+
+TEST(LaserScanConversionsTest, partialScanShouldCoverExpectedAngles)
+{
+  const auto complete_stamped_msgs = createValidStampedMsgs(3);
+  const std::size_t samples_per_msg{ complete_stamped_msgs[0].msg_.measurements().size() };
+  const std::vector<MessageStamped> stamped_msgs{ complete_stamped_msgs[1] };
+  const data_conversion_layer::ScanAngles expected_angles{ util::TenthOfDegree{ 10 }, util::TenthOfDegree{ 50 } };
+
+  boost::optional<LaserScan> scan;
+  ASSERT_EQ(data_conversion_layer::ScanConversionStatus::ok,
+            data_conversion_layer::LaserScanConverter::tryToPartialLaserScan(stamped_msgs, expected_angles, scan));
+
+  EXPECT_EQ(2 * samples_per_msg, scan->numberOfMissingMeasurements());
+  EXPECT_EQ(expected_angles.min_angle, scan->minScanAngle());
+  EXPECT_EQ(expected_angles.max_angle, scan->maxScanAngle());
+  ASSERT_EQ(3 * samples_per_msg, scan->measurements().size());
+  EXPECT_TRUE(std::isnan(scan->measurements().front()));
+  EXPECT_DOUBLE_EQ(stamped_msgs[0].msg_.measurements()[0], scan->measurements()[samples_per_msg]);
+  EXPECT_TRUE(std::isnan(scan->measurements().back()));
+  EXPECT_EQ(data_conversion_layer::LaserScanConverter::calculateFirstRayTime(
+                stamped_msgs[0].stamp_, stamped_msgs[0].msg_.resolution(), 2 * samples_per_msg),
+            scan->timestamp());
+  EXPECT_EQ(1u, scan->ioStates().size());
+}
+
+TEST(LaserScanConversionsTest, partialScanShouldNotBeFlaggedIfNoMeasurementIsMissing)
+{
+  const auto stamped_msgs = createValidStampedMsgs(3);
+
+  boost::optional<LaserScan> scan;
+  ASSERT_EQ(data_conversion_layer::ScanConversionStatus::ok,
+            data_conversion_layer::LaserScanConverter::tryToPartialLaserScan(stamped_msgs, boost::none, scan));
+  EXPECT_FALSE(scan->isPartial());
+  const auto complete_scan = data_conversion_layer::LaserScanConverter::toLaserScan(stamped_msgs);
+  EXPECT_EQ(complete_scan.measurements(), scan->measurements());
+  EXPECT_EQ(complete_scan.maxScanAngle(), scan->maxScanAngle());
+  EXPECT_EQ(complete_scan.timestamp(), scan->timestamp());
+}
+
+TEST(LaserScanConversionsTest, partialScanShouldFillGapsOfRawSamplesWithMissingRawMeasurement)
+{
+  const std::vector<MessageStamped> stamped_msgs{
+    MessageStamped(MessageBuilder()
+                       .fromTheta(util::TenthOfDegree{ 10 })
+                       .resolution(util::TenthOfDegree{ 2 })
+                       .scanCounter(42)
+                       .activeZoneset(0)
+                       .rawMeasurements({ 1000, 2000 })
+                       .rawIntensities({ 10, 20 }),
+                   DEFAULT_TIMESTAMP),
+    MessageStamped(MessageBuilder()
+                       .fromTheta(util::TenthOfDegree{ 18 })
+                       .resolution(util::TenthOfDegree{ 2 })
+                       .scanCounter(42)
+                       .activeZoneset(0)
+                       .rawMeasurements({ 3000 })
+                       .rawIntensities({ 30 }),
+                   DEFAULT_TIMESTAMP)
+  };
+
+  boost::optional<LaserScan> scan;
+  ASSERT_EQ(data_conversion_layer::ScanConversionStatus::ok,
+            data_conversion_layer::LaserScanConverter::tryToPartialLaserScan(stamped_msgs, boost::none, scan));
+
+  const uint16_t missing{ LaserScan::MISSING_RAW_MEASUREMENT };
+  EXPECT_EQ(LaserScan::RawMeasurementData({ 1000, 2000, missing, missing, 3000 }), scan->rawMeasurements());
+  EXPECT_EQ(LaserScan::RawIntensityData({ 10, 20, 0, 0, 30 }), scan->rawIntensities());
+  EXPECT_EQ(2u, scan->numberOfMissingMeasurements());
+}
+
+TEST(LaserScanConversionsTest, partialScanShouldFillGapsOfSinglePrecisionDataWithNaN)
+{
+  const std::vector<MessageStamped> stamped_msgs{
+    MessageStamped(MessageBuilder()
+                       .fromTheta(util::TenthOfDegree{ 10 })
+                       .resolution(util::TenthOfDegree{ 2 })
+                       .scanCounter(42)
+                       .activeZoneset(0)
+                       .singlePrecisionMeasurements({ 1.f }),
+                   DEFAULT_TIMESTAMP),
+    MessageStamped(MessageBuilder()
+                       .fromTheta(util::TenthOfDegree{ 14 })
+                       .resolution(util::TenthOfDegree{ 2 })
+                       .scanCounter(42)
+                       .activeZoneset(0)
+                       .singlePrecisionMeasurements({ 3.f }),
+                   DEFAULT_TIMESTAMP)
+  };
+
+  boost::optional<LaserScan> scan;
+  ASSERT_EQ(data_conversion_layer::ScanConversionStatus::ok,
+            data_conversion_layer::LaserScanConverter::tryToPartialLaserScan(stamped_msgs, boost::none, scan));
+
+  ASSERT_EQ(3u, scan->singlePrecisionMeasurements().size());
+  EXPECT_FLOAT_EQ(1.f, scan->singlePrecisionMeasurements()[0]);
+  EXPECT_TRUE(std::isnan(scan->singlePrecisionMeasurements()[1]));
+  EXPECT_FLOAT_EQ(3.f, scan->singlePrecisionMeasurements()[2]);
+  EXPECT_TRUE(scan->singlePrecisionIntensities().empty());
+}
+
+TEST(LaserScanConversionsTest, tryToPartialLaserScanShouldReturnStatusOnOverlappingFrames)
+{
+  auto stamped_msgs = createValidStampedMsgs(2);
+  ADD_OFFSET_TO_SCALAR_MSG_PROPERTY(stamped_msgs[1].msg_, fromTheta, util::TenthOfDegree{ -2 });
+
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(data_conversion_layer::ScanConversionStatus::theta_angles_mismatch,
+            data_conversion_layer::LaserScanConverter::tryToPartialLaserScan(stamped_msgs, boost::none, scan));
+  EXPECT_FALSE(scan.is_initialized());
+}
+
+TEST(LaserScanConversionsTest, tryToPartialLaserScanShouldReturnStatusOnMisalignedFrames)
+{
+  auto stamped_msgs = createValidStampedMsgs(2);
+  ADD_OFFSET_TO_SCALAR_MSG_PROPERTY(stamped_msgs[1].msg_, fromTheta, util::TenthOfDegree{ 1 });
+
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(data_conversion_layer::ScanConversionStatus::theta_angles_mismatch,
+            data_conversion_layer::LaserScanConverter::tryToPartialLaserScan(stamped_msgs, boost::none, scan));
+}
+
+TEST(LaserScanConversionsTest, tryToPartialLaserScanShouldReturnStatusOnZeroResolution)
+{
+  const std::vector<MessageStamped> stamped_msgs{ MessageStamped(
+      createDefaultMsgBuilder().resolution(util::TenthOfDegree{ 0 }), DEFAULT_TIMESTAMP) };
+  const data_conversion_layer::ScanAngles expected_angles{ util::TenthOfDegree{ 0 }, util::TenthOfDegree{ 100 } };
+
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(data_conversion_layer::ScanConversionStatus::invalid_resolution,
+            data_conversion_layer::LaserScanConverter::tryToPartialLaserScan(stamped_msgs, expected_angles, scan));
+  EXPECT_FALSE(scan.is_initialized());
+}
+
+TEST(LaserScanConversionsTest, tryToPartialLaserScanShouldReturnStatusOnMissingFrames)
+{
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(data_conversion_layer::ScanConversionStatus::no_frames,
+            data_conversion_layer::LaserScanConverter::tryToPartialLaserScan({}, boost::none, scan));
+}
+
 }  // namespace psen_scan_v2_standalone_test
 
 int main(int argc, char* argv[])
@@ -55,6 +55,13 @@ TEST(MonitoringFrameMsgTest, shouldThrowAdditionalFieldMissingWhenTryingToGetUns
       FrameMessage().intensities(), AdditionalFieldMissing, ("Intensities" + ADDITIONAL_FIELD_MISSING_TEXT).c_str());
 }
 
+TEST(MonitoringFrameMsgTest, shouldThrowAdditionalFieldMissingWhenTryingToGetUnsetIntensityFlags)
+{
+  EXPECT_THROW_AND_WHAT(FrameMessage().intensityFlags(),
+                        AdditionalFieldMissing,
+                        ("Intensity flags" + ADDITIONAL_FIELD_MISSING_TEXT).c_str());
+}
+
 TEST(MonitoringFrameMsgTest, shouldThrowAdditionalFieldMissingWhenTryingToGetUnsetActiveZoneset)
 {
   EXPECT_THROW_AND_WHAT(FrameMessage().activeZoneset(),
@@ -161,6 +168,14 @@ TEST(MonitoringFrameMsgTest, shouldReturnCorrectIntensities)
   EXPECT_EQ(expected_intensities, intensities);
 }
 
+TEST(MonitoringFrameMsgTest, shouldReturnCorrectIntensityFlags)
+{
+  const std::vector<uint8_t> expected_intensity_flags{ { 0b11000110, 0b01 } };
+  std::vector<uint8_t> intensity_flags;
+  ASSERT_NO_THROW(intensity_flags = MessageBuilder().intensityFlags(expected_intensity_flags).build().intensityFlags());
+  EXPECT_EQ(expected_intensity_flags, intensity_flags);
+}
+
 TEST(MonitoringFrameMsgTest, shouldReturnCorrectIOPin)
 {
   io::PinData expected_io_pin_data;
@@ -0,0 +1,177 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg_builder.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg_view.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg_helper.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_serialization.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_data_array_conversion.h"
+#include "psen_scan_v2_standalone/communication_layer/udp_frame_dumps.h"
+#include "psen_scan_v2_standalone/util/gtest_expectations.h"
+#include "psen_scan_v2_standalone/util/matchers_and_actions.h"
+
+using namespace psen_scan_v2_standalone;
+using namespace data_conversion_layer;
+
+namespace psen_scan_v2_standalone_test
+{
+static RawDataPtr toRawDataPtr(const RawData& raw)
+{
+  return std::make_shared<RawData>(raw);
+}
+
+class MonitoringFrameMsgViewTest : public ::testing::Test
+{
+protected:
+  MonitoringFrameMsgViewTest() : with_intensities_raw_(toRawDataPtr(convertToRawData(with_intensities_.hex_dump)))
+  {
+  }
+
+protected:
+  scanner_udp_datagram_hexdumps::WithIntensitiesAndDiagnostics with_intensities_;
+  RawDataPtr with_intensities_raw_;
+};
+
+TEST_F(MonitoringFrameMsgViewTest, shouldProvideSameFieldsAsDeserialize)
+{
+  const monitoring_frame::MessageView view(with_intensities_raw_, with_intensities_raw_->size());
+  EXPECT_THAT(view, MonitoringFrameEq(with_intensities_.expected_msg_));
+  EXPECT_EQ(with_intensities_.expected_msg_.scannerId(), view.scannerId());
+}
+
+TEST_F(MonitoringFrameMsgViewTest, shouldConvertToMessage)
+{
+  const monitoring_frame::MessageView view(with_intensities_raw_, with_intensities_raw_->size());
+  const auto msg{ monitoring_frame::deserialize(*with_intensities_raw_, with_intensities_raw_->size()) };
+  EXPECT_THAT(view.toMessage(), MonitoringFrameEq(msg));
+  EXPECT_EQ(msg.intensityFlags(), view.toMessage().intensityFlags());
+}
+
+TEST_F(MonitoringFrameMsgViewTest, shouldDecodeMeasurementsOnFirstAccess)
+{
+  const auto msg = monitoring_frame::MessageBuilder()
+                       .fromTheta(util::TenthOfDegree(25))
+                       .resolution(util::TenthOfDegree(1))
+                       .scanCounter(42)
+                       .activeZoneset(1)
+                       .measurements({ 1., 2. })
+                       .build();
+  const auto raw{ toRawDataPtr(monitoring_frame::serialize(msg)) };
+
+  const monitoring_frame::MessageView view(raw, raw->size());
+  EXPECT_EQ(42u, view.scanCounter());
+  EXPECT_EQ(1u, view.activeZoneset());
+
+  // The measurements are the last field before the end of frame marker (4 bytes).
+  const auto raw_measurements_begin{ raw->end() - 4 - 2 * monitoring_frame::NUMBER_OF_BYTES_SINGLE_MEASUREMENT };
+
+  // Modify the raw measurements after the scan, the view must only read them on access.
+  std::fill(raw_measurements_begin, raw->end() - 4, 0);
+  EXPECT_EQ(std::vector<double>({ 0., 0. }), view.measurements());
+
+  // Once decoded, the measurements are cached.
+  std::fill(raw_measurements_begin, raw->end() - 4, 1);
+  EXPECT_EQ(std::vector<double>({ 0., 0. }), view.measurements());
+}
+
+TEST_F(MonitoringFrameMsgViewTest, shouldThrowAdditionalFieldMissingForMissingFields)
+{
+  const auto msg = monitoring_frame::MessageBuilder()
+                       .fromTheta(util::TenthOfDegree(25))
+                       .resolution(util::TenthOfDegree(1))
+                       .scanCounter(42)
+                       .build();
+  const auto raw{ toRawDataPtr(monitoring_frame::serialize(msg)) };
+
+  const monitoring_frame::MessageView view(raw, raw->size());
+  EXPECT_TRUE(view.hasScanCounterField());
+  EXPECT_FALSE(view.hasActiveZonesetField());
+  EXPECT_FALSE(view.hasIOPinField());
+  EXPECT_FALSE(view.hasMeasurementsField());
+  EXPECT_FALSE(view.hasIntensitiesField());
+  EXPECT_FALSE(view.hasDiagnosticMessagesField());
+
+  EXPECT_THROW(view.activeZoneset(), monitoring_frame::AdditionalFieldMissing);
+  EXPECT_THROW(view.iOPinData(), monitoring_frame::AdditionalFieldMissing);
+  EXPECT_THROW(view.measurements(), monitoring_frame::AdditionalFieldMissing);
+  EXPECT_THROW(view.intensities(), monitoring_frame::AdditionalFieldMissing);
+  EXPECT_THROW(view.intensityFlags(), monitoring_frame::AdditionalFieldMissing);
+  EXPECT_THROW(view.diagnosticMessages(), monitoring_frame::AdditionalFieldMissing);
+}
+
+TEST_F(MonitoringFrameMsgViewTest, shouldThrowDecodingFailureOnTruncatedFrame)
+{
+  EXPECT_THROW(monitoring_frame::MessageView(with_intensities_raw_, with_intensities_raw_->size() - 50),
+               monitoring_frame::DecodingFailure);
+}
+
+TEST_F(MonitoringFrameMsgViewTest, shouldThrowUnexpectedSizeErrorOnTooLargeScanCounterLength)
+{
+  scanner_udp_datagram_hexdumps::WithTooLargeScanCounterLength with_too_large_scan_counter_length;
+  const auto raw{ toRawDataPtr(convertToRawData(with_too_large_scan_counter_length.hex_dump)) };
+
+  EXPECT_THROW(monitoring_frame::MessageView(raw, raw->size()), monitoring_frame::AdditionalFieldUnexpectedSize);
+}
+
+TEST_F(MonitoringFrameMsgViewTest, shouldThrowUnexpectedSizeErrorOnTooLargeZoneSetLength)
+{
+  scanner_udp_datagram_hexdumps::WithTooLargeActiveZoneSetLength with_too_large_active_zone_set_length;
+  const auto raw{ toRawDataPtr(convertToRawData(with_too_large_active_zone_set_length.hex_dump)) };
+
+  EXPECT_THROW(monitoring_frame::MessageView(raw, raw->size()), monitoring_frame::AdditionalFieldUnexpectedSize);
+}
+
+TEST_F(MonitoringFrameMsgViewTest, shouldThrowUnexpectedSizeErrorOnTooSmallIOStateFieldLength)
+{
+  scanner_udp_datagram_hexdumps::WithTooSmallIOStateFieldLength with_too_small_io_state_field_length;
+  const auto raw{ toRawDataPtr(convertToRawData(with_too_small_io_state_field_length.hex_dump)) };
+
+  EXPECT_THROW(monitoring_frame::MessageView(raw, raw->size()), monitoring_frame::AdditionalFieldUnexpectedSize);
+}
+
+TEST_F(MonitoringFrameMsgViewTest, shouldThrowUnexpectedSizeErrorOnTooSmallDiagnosticsFieldLength)
+{
+  const std::array<uint8_t, 39> too_small_diagnostics_dump = {
+    0x00, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x05, 0x0a, 0x00,  // End of FixedFields
+    0x02, 0x05, 0x00, 0xfc, 0x61, 0x06, 0x00,                    // Scan counter
+    0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,                    // Diagnostics, shorter than one raw chunk
+    0x09, 0x00, 0x00, 0x00                                       // End of Frame
+  };
+  const auto raw{ toRawDataPtr(convertToRawData(too_small_diagnostics_dump)) };
+
+  EXPECT_THROW(monitoring_frame::MessageView(raw, raw->size()), monitoring_frame::AdditionalFieldUnexpectedSize);
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
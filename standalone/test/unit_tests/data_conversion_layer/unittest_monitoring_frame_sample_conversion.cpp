@@ -0,0 +1,198 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_sample_conversion.h"
+
+using namespace psen_scan_v2_standalone::data_conversion_layer::monitoring_frame;
+
+namespace psen_scan_v2_standalone_test
+{
+static const std::vector<ConversionKernel> ALL_KERNELS{ ConversionKernel::scalar,
+                                                        ConversionKernel::sse2,
+                                                        ConversionKernel::avx2 };
+
+static std::vector<char> toRaw(const std::vector<uint16_t>& samples)
+{
+  std::vector<char> raw(samples.size() * sizeof(uint16_t));
+  std::memcpy(raw.data(), samples.data(), raw.size());
+  return raw;
+}
+
+//! @brief Covers all possible raw values, with a length that is no multiple of any vector width.
+static std::vector<uint16_t> allRawValues()
+{
+  std::vector<uint16_t> samples(std::numeric_limits<uint16_t>::max() + 1 + 7);
+  for (std::size_t i = 0; i < samples.size(); ++i)
+  {
+    samples[i] = static_cast<uint16_t>(i);
+  }
+  return samples;
+}
+
+TEST(MonitoringFrameSampleConversionTest, shouldConvertToMeter)
+{
+  const auto raw{ toRaw({ 0, 1, 1000, 1234, 65535 }) };
+  for (const auto& kernel : ALL_KERNELS)
+  {
+    std::vector<double> measurements(5);
+    convertRawMeasurements(raw.data(), 5, measurements.data(), kernel);
+    EXPECT_EQ(std::vector<double>({ 0., .001, 1., 1.234, 65.535 }), measurements) << toString(kernel);
+  }
+}
+
+TEST(MonitoringFrameSampleConversionTest, shouldMapSpecialValuesToInfinity)
+{
+  const auto raw{ toRaw({ 1, NO_SIGNAL_ARRIVED, 2, SIGNAL_TOO_LATE, 3, 4, 5, 6, NO_SIGNAL_ARRIVED, SIGNAL_TOO_LATE }) };
+  for (const auto& kernel : ALL_KERNELS)
+  {
+    std::vector<double> measurements(10);
+    convertRawMeasurements(raw.data(), 10, measurements.data(), kernel);
+    EXPECT_TRUE(std::isinf(measurements.at(1))) << toString(kernel);
+    EXPECT_TRUE(std::isinf(measurements.at(3))) << toString(kernel);
+    EXPECT_TRUE(std::isinf(measurements.at(8))) << toString(kernel);
+    EXPECT_TRUE(std::isinf(measurements.at(9))) << toString(kernel);
+    EXPECT_DOUBLE_EQ(.006, measurements.at(7)) << toString(kernel);
+  }
+}
+
+TEST(MonitoringFrameSampleConversionTest, allKernelsShouldMatchScalarKernel)
+{
+  const auto samples{ allRawValues() };
+  const auto raw{ toRaw(samples) };
+
+  std::vector<double> expected(samples.size());
+  convertRawMeasurements(raw.data(), samples.size(), expected.data(), ConversionKernel::scalar);
+
+  for (const auto& kernel : ALL_KERNELS)
+  {
+    std::vector<double> measurements(samples.size());
+    convertRawMeasurements(raw.data(), samples.size(), measurements.data(), kernel);
+    EXPECT_EQ(0, std::memcmp(expected.data(), measurements.data(), expected.size() * sizeof(double)))
+        << toString(kernel);
+  }
+}
+
+TEST(MonitoringFrameSampleConversionTest, allSinglePrecisionKernelsShouldMatchScalarKernel)
+{
+  const auto samples{ allRawValues() };
+  const auto raw{ toRaw(samples) };
+
+  std::vector<float> expected(samples.size());
+  convertRawMeasurements(raw.data(), samples.size(), expected.data(), ConversionKernel::scalar);
+  EXPECT_FLOAT_EQ(1.234f, expected.at(1234));
+
+  for (const auto& kernel : ALL_KERNELS)
+  {
+    std::vector<float> measurements(samples.size());
+    convertRawMeasurements(raw.data(), samples.size(), measurements.data(), kernel);
+    EXPECT_EQ(0, std::memcmp(expected.data(), measurements.data(), expected.size() * sizeof(float)))
+        << toString(kernel);
+  }
+}
+
+TEST(MonitoringFrameSampleConversionTest, shouldHandleUnalignedInput)
+{
+  const auto samples{ allRawValues() };
+  std::vector<char> raw(samples.size() * sizeof(uint16_t) + 1);
+  std::memcpy(raw.data() + 1, samples.data(), samples.size() * sizeof(uint16_t));
+
+  std::vector<double> expected(samples.size());
+  convertRawMeasurements(raw.data() + 1, samples.size(), expected.data(), ConversionKernel::scalar);
+  for (const auto& kernel : ALL_KERNELS)
+  {
+    std::vector<double> measurements(samples.size());
+    convertRawMeasurements(raw.data() + 1, samples.size(), measurements.data(), kernel);
+    EXPECT_EQ(expected, measurements) << toString(kernel);
+  }
+}
+
+TEST(MonitoringFrameSampleConversionTest, shouldNotWriteBeyondNumberOfSamples)
+{
+  const auto raw{ toRaw({ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 }) };
+  for (const auto& kernel : ALL_KERNELS)
+  {
+    std::vector<double> measurements(11, -1.);
+    convertRawMeasurements(raw.data(), 9, measurements.data(), kernel);
+    EXPECT_DOUBLE_EQ(.009, measurements.at(8)) << toString(kernel);
+    EXPECT_EQ(-1., measurements.at(9)) << toString(kernel);
+    EXPECT_EQ(-1., measurements.at(10)) << toString(kernel);
+  }
+}
+
+TEST(MonitoringFrameSampleConversionTest, shouldStripFlagsFromIntensities)
+{
+  const auto raw{ toRaw({ 0b0100000000000001, 0b1000000000000010, 0b1100000000000011, 4, 0b0011111111111111 }) };
+  for (const auto& kernel : ALL_KERNELS)
+  {
+    std::vector<double> intensities(5);
+    std::vector<uint8_t> flags(numberOfIntensityFlagBytes(5));
+    convertRawIntensities(raw.data(), 5, intensities.data(), flags.data(), kernel);
+    EXPECT_EQ(std::vector<double>({ 1., 2., 3., 4., 16383. }), intensities) << toString(kernel);
+    EXPECT_EQ(std::vector<uint8_t>({ 0b00111001, 0b00 }), flags) << toString(kernel);
+  }
+}
+
+TEST(MonitoringFrameSampleConversionTest, allIntensityKernelsShouldMatchScalarKernel)
+{
+  const auto samples{ allRawValues() };
+  const auto raw{ toRaw(samples) };
+
+  std::vector<double> expected(samples.size());
+  std::vector<uint8_t> expected_flags(numberOfIntensityFlagBytes(samples.size()));
+  convertRawIntensities(raw.data(), samples.size(), expected.data(), expected_flags.data(), ConversionKernel::scalar);
+  for (std::size_t i = 0; i < samples.size(); ++i)
+  {
+    ASSERT_EQ(samples.at(i) >> 14, intensityFlags(expected_flags.data(), i)) << "index " << i;
+    ASSERT_EQ(samples.at(i) & 0x3FFF, expected.at(i)) << "index " << i;
+  }
+
+  for (const auto& kernel : ALL_KERNELS)
+  {
+    std::vector<double> intensities(samples.size());
+    std::vector<float> intensities_float(samples.size());
+    std::vector<uint8_t> flags(expected_flags.size(), 0xFF);
+    std::vector<uint8_t> flags_float(expected_flags.size(), 0xFF);
+    convertRawIntensities(raw.data(), samples.size(), intensities.data(), flags.data(), kernel);
+    convertRawIntensities(raw.data(), samples.size(), intensities_float.data(), flags_float.data(), kernel);
+
+    EXPECT_EQ(expected, intensities) << toString(kernel);
+    EXPECT_EQ(std::vector<float>(expected.begin(), expected.end()), intensities_float) << toString(kernel);
+    EXPECT_EQ(expected_flags, flags) << toString(kernel);
+    EXPECT_EQ(expected_flags, flags_float) << toString(kernel);
+  }
+}
+
+TEST(MonitoringFrameSampleConversionTest, bestKernelShouldBeStable)
+{
+  EXPECT_EQ(bestConversionKernel(), bestConversionKernel());
+  EXPECT_FALSE(toString(bestConversionKernel()).empty());
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -13,6 +13,7 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+#include <cmath>
 #include <vector>
 #include <array>
 
@@ -24,6 +25,7 @@
 #include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg_builder.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_sample_conversion.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/raw_processing.h"
 #include "psen_scan_v2_standalone/configuration/scanner_ids.h"
 #include "psen_scan_v2_standalone/io_state.h"
@@ -185,6 +187,25 @@ TEST(MonitoringFrameSerializationTest, shouldFailOnSerializeAndDeserializeFrameW
   EXPECT_EQ(static_cast<uint32_t>(deserialized_msg.intensities().at(0)) & intensity_channel_bit_mask, 0u);
 }
 
+TEST(MonitoringFrameSerializationTest, shouldKeepIntensityChannelBitsAsIntensityFlags)
+{
+  auto msg = data_conversion_layer::monitoring_frame::MessageBuilder()
+                 .fromTheta(util::TenthOfDegree(25))
+                 .resolution(util::TenthOfDegree(1))
+                 .scanCounter(1)
+                 .activeZoneset(0)
+                 .measurements({ 0, 0, 0, 0, 0 })
+                 .intensities({ 0b0100000000000001, 0b1000000000000010, 0b1100000000000011, 4, 0b1100000000000101 })
+                 .diagnosticMessages({})
+                 .build();
+
+  auto raw = serialize(msg);
+  auto deserialized_msg = monitoring_frame::deserialize(convertToRawData(raw), raw.size());
+
+  EXPECT_EQ(std::vector<double>({ 1, 2, 3, 4, 5 }), deserialized_msg.intensities());
+  EXPECT_EQ(std::vector<uint8_t>({ 0b00111001, 0b11 }), deserialized_msg.intensityFlags());
+}
+
 TEST(MonitoringFrameSerializationDiagnosticMessagesTest, shouldSetCorrectBitInSerializedDiagnosticData)
 {
   std::vector<monitoring_frame::diagnostic::Message> diagnostic_data{
@@ -196,6 +217,46 @@ TEST(MonitoringFrameSerializationDiagnosticMessagesTest, shouldSetCorrectBitInSe
   EXPECT_EQ(diagnostic_data_serialized.at(monitoring_frame::diagnostic::RAW_CHUNK_UNUSED_OFFSET_IN_BYTES + 5), 0b1000);
 }
 
+TEST(MonitoringFrameMaxFrameSizeTest, shouldMatchSizeOfFrameWithAllFieldsAndCompleteScan)
+{
+  const util::TenthOfDegree resolution{ 1 };
+  const auto msg{ monitoring_frame::MessageBuilder()
+                      .fromTheta(util::TenthOfDegree(0))
+                      .resolution(resolution)
+                      .iOPinData(io::PinData())
+                      .scanCounter(42)
+                      .activeZoneset(3)
+                      .diagnosticMessages({})
+                      .measurements(std::vector<double>(2751, 1.))
+                      .build() };
+
+  EXPECT_EQ(monitoring_frame::serialize(msg).size(), monitoring_frame::maxFrameSize(resolution, false));
+}
+
+TEST(MonitoringFrameMaxFrameSizeTest, shouldMatchSizeOfFrameWithIntensitiesAndCompleteScan)
+{
+  const util::TenthOfDegree resolution{ 2 };
+  const auto msg{ monitoring_frame::MessageBuilder()
+                      .fromTheta(util::TenthOfDegree(0))
+                      .resolution(resolution)
+                      .iOPinData(io::PinData())
+                      .scanCounter(42)
+                      .activeZoneset(3)
+                      .diagnosticMessages({})
+                      .measurements(std::vector<double>(1376, 1.))
+                      .intensities(std::vector<double>(1376, 1.))
+                      .build() };
+
+  EXPECT_EQ(monitoring_frame::serialize(msg).size(), monitoring_frame::maxFrameSize(resolution, true));
+}
+
+TEST(MonitoringFrameMaxFrameSizeTest, shouldRoundUpNumberOfSamplesForResolutionNotDividingScanAngle)
+{
+  const std::size_t samples_size_difference{ monitoring_frame::maxFrameSize(util::TenthOfDegree(3), false) -
+                                             monitoring_frame::maxFrameSize(util::TenthOfDegree(100), false) };
+  EXPECT_EQ((918u - 29u) * monitoring_frame::NUMBER_OF_BYTES_SINGLE_MEASUREMENT, samples_size_difference);
+}
+
 TEST(MonitoringFrameDeserializationFieldHeaderTest, shouldGetIdAndLengthCorrectly)
 {
   uint8_t id = 5;
@@ -255,6 +316,116 @@ TEST_F(MonitoringFrameDeserializationTest, shouldDeserializeMonitoringFrameCorre
   EXPECT_THAT(msg, MonitoringFrameEq(with_intensities_.expected_msg_));
 }
 
+TEST_F(MonitoringFrameDeserializationTest, shouldSkipFieldsNotSelectedInDecodeOptions)
+{
+  const auto options{ monitoring_frame::DecodeOptions::none()
+                          .with(monitoring_frame::DecodeField::zoneset)
+                          .with(monitoring_frame::DecodeField::measurements) };
+
+  monitoring_frame::Message msg;
+  ASSERT_NO_THROW(msg = monitoring_frame::deserialize(with_intensities_raw_, with_intensities_raw_.size(), options););
+  EXPECT_FALSE(msg.hasScanCounterField());
+  EXPECT_FALSE(msg.hasIntensitiesField());
+  EXPECT_FALSE(msg.hasIOPinField());
+  EXPECT_FALSE(msg.hasDiagnosticMessagesField());
+  EXPECT_EQ(with_intensities_.expected_msg_.activeZoneset(), msg.activeZoneset());
+  EXPECT_THAT(msg.measurements(), PointwiseDoubleEq(with_intensities_.expected_msg_.measurements()));
+}
+
+TEST_F(MonitoringFrameDeserializationTest, shouldDecodeNoAdditionalFieldsWithEmptyDecodeOptions)
+{
+  monitoring_frame::Message msg;
+  ASSERT_NO_THROW(msg = monitoring_frame::deserialize(
+                      with_intensities_raw_, with_intensities_raw_.size(), monitoring_frame::DecodeOptions::none()););
+  EXPECT_FALSE(msg.hasScanCounterField());
+  EXPECT_FALSE(msg.hasActiveZonesetField());
+  EXPECT_FALSE(msg.hasMeasurementsField());
+  EXPECT_EQ(with_intensities_.expected_msg_.fromTheta(), msg.fromTheta());
+}
+
+TEST_F(MonitoringFrameDeserializationTest, shouldDecodeMeasurementsAndIntensitiesInSinglePrecision)
+{
+  monitoring_frame::Message msg;
+  ASSERT_NO_THROW(msg = monitoring_frame::deserialize(with_intensities_raw_,
+                                                      with_intensities_raw_.size(),
+                                                      monitoring_frame::DecodeOptions().withSinglePrecision()););
+  ASSERT_TRUE(msg.isSinglePrecision());
+  EXPECT_THROW(msg.measurements(), monitoring_frame::AdditionalFieldMissing);
+  EXPECT_THROW(msg.intensities(), monitoring_frame::AdditionalFieldMissing);
+
+  const auto& expected_measurements{ with_intensities_.expected_msg_.measurements() };
+  const auto& expected_intensities{ with_intensities_.expected_msg_.intensities() };
+  ASSERT_EQ(expected_measurements.size(), msg.numberOfMeasurements());
+  EXPECT_EQ(expected_intensities.size(), msg.numberOfIntensities());
+  ASSERT_EQ(expected_intensities.size(), msg.singlePrecisionIntensities().size());
+  for (std::size_t i = 0; i < expected_measurements.size(); ++i)
+  {
+    EXPECT_FLOAT_EQ(static_cast<float>(expected_measurements[i]), msg.singlePrecisionMeasurements()[i]);
+    EXPECT_FLOAT_EQ(static_cast<float>(expected_intensities[i]), msg.singlePrecisionIntensities()[i]);
+  }
+  EXPECT_EQ(monitoring_frame::deserialize(with_intensities_raw_, with_intensities_raw_.size()).intensityFlags(),
+            msg.intensityFlags());
+}
+
+TEST_F(MonitoringFrameDeserializationTest, shouldKeepRawSamplesIfSelectedInDecodeOptions)
+{
+  monitoring_frame::Message msg;
+  ASSERT_NO_THROW(msg = monitoring_frame::deserialize(with_intensities_raw_,
+                                                      with_intensities_raw_.size(),
+                                                      monitoring_frame::DecodeOptions().withRawSamples()););
+  ASSERT_TRUE(msg.hasRawSamples());
+  EXPECT_FALSE(msg.isSinglePrecision());
+  EXPECT_THROW(msg.measurements(), monitoring_frame::AdditionalFieldMissing);
+  EXPECT_THROW(msg.intensityFlags(), monitoring_frame::AdditionalFieldMissing);
+
+  const auto& expected_measurements{ with_intensities_.expected_msg_.measurements() };
+  const auto& expected_intensities{ with_intensities_.expected_msg_.intensities() };
+  ASSERT_EQ(expected_measurements.size(), msg.numberOfMeasurements());
+  EXPECT_EQ(expected_intensities.size(), msg.numberOfIntensities());
+  ASSERT_EQ(expected_intensities.size(), msg.rawIntensities().size());
+  for (std::size_t i = 0; i < expected_measurements.size(); ++i)
+  {
+    if (std::isfinite(expected_measurements[i]))
+    {
+      EXPECT_DOUBLE_EQ(expected_measurements[i], msg.rawMeasurements()[i] / 1000.);
+    }
+    EXPECT_DOUBLE_EQ(expected_intensities[i], msg.rawIntensities()[i] & monitoring_frame::INTENSITY_VALUE_MASK);
+  }
+}
+
+TEST_F(MonitoringFrameDeserializationTest, shouldDeserializeFieldsInAnyOrder)
+{
+  const auto create_builder = []() {
+    return monitoring_frame::MessageBuilder().fromTheta(util::TenthOfDegree(25)).resolution(util::TenthOfDegree(1));
+  };
+  const monitoring_frame::Message expected_msg{
+    create_builder().iOPinData(io::PinData()).scanCounter(42).activeZoneset(3).diagnosticMessages({}).measurements(
+        { 1., 2. }).intensities({ 5., 7. })
+  };
+
+  // The serialization uses the order of the scanner, so the fields of two serialized frames are swapped.
+  static constexpr std::size_t NUMBER_OF_BYTES_END_OF_FRAME{ 4 };
+  const RawData empty_frame{ monitoring_frame::serialize(create_builder()) };
+  const RawData counter_frame{ monitoring_frame::serialize(
+      create_builder().iOPinData(io::PinData()).scanCounter(42).activeZoneset(3).diagnosticMessages({})) };
+  const RawData samples_frame{ monitoring_frame::serialize(
+      create_builder().measurements({ 1., 2. }).intensities({ 5., 7. })) };
+  const std::size_t num_bytes_fixed_fields{ empty_frame.size() - NUMBER_OF_BYTES_END_OF_FRAME };
+
+  RawData reordered_frame(empty_frame.begin(), empty_frame.begin() + num_bytes_fixed_fields);
+  reordered_frame.insert(reordered_frame.end(),
+                         samples_frame.begin() + num_bytes_fixed_fields,
+                         samples_frame.end() - NUMBER_OF_BYTES_END_OF_FRAME);
+  reordered_frame.insert(reordered_frame.end(),
+                         counter_frame.begin() + num_bytes_fixed_fields,
+                         counter_frame.end() - NUMBER_OF_BYTES_END_OF_FRAME);
+  reordered_frame.insert(reordered_frame.end(), empty_frame.end() - NUMBER_OF_BYTES_END_OF_FRAME, empty_frame.end());
+
+  monitoring_frame::Message msg;
+  ASSERT_NO_THROW(msg = monitoring_frame::deserialize(reordered_frame, reordered_frame.size()));
+  EXPECT_THAT(msg, MonitoringFrameEq(expected_msg));
+}
+
 TEST_F(MonitoringFrameDeserializationTest, shouldThrowMonitoringFrameFormatErrorOnUnknownFieldId)
 {
   scanner_udp_datagram_hexdumps::WithUnknownFieldId with_unknown_field_id;
@@ -295,6 +466,79 @@ TEST_F(MonitoringFrameDeserializationTest, shouldThrowMonitoringFrameFormatError
   EXPECT_THROW(msg = monitoring_frame::deserialize(raw_frame_data, num_bytes);, monitoring_frame::DecodingFailure);
 }
 
+TEST_F(MonitoringFrameDeserializationTest, shouldThrowMonitoringFrameFormatErrorOnTruncatedFrame)
+{
+  auto msg = monitoring_frame::MessageBuilder()
+                 .fromTheta(util::TenthOfDegree(25))
+                 .resolution(util::TenthOfDegree(1))
+                 .scanCounter(1)
+                 .measurements(std::vector<double>(100, 1.))
+                 .build();
+  const auto raw = serialize(msg);
+  const auto num_bytes_without_end_of_measurements = raw.size() - 50;
+
+  EXPECT_THROW(monitoring_frame::deserialize(raw, num_bytes_without_end_of_measurements);
+               , monitoring_frame::DecodingFailure);
+}
+
+TEST_F(MonitoringFrameDeserializationTest, tryDeserializeShouldReturnOkAndSameMessageAsDeserialize)
+{
+  monitoring_frame::Message msg;
+  EXPECT_EQ(monitoring_frame::DecodingStatus::ok,
+            monitoring_frame::tryDeserialize(
+                with_intensities_raw_, with_intensities_raw_.size(), monitoring_frame::DecodeOptions(), msg));
+  EXPECT_THAT(msg, MonitoringFrameEq(with_intensities_.expected_msg_));
+}
+
+TEST_F(MonitoringFrameDeserializationTest, tryDeserializeShouldReturnStatusOnUnknownFieldId)
+{
+  scanner_udp_datagram_hexdumps::WithUnknownFieldId with_unknown_field_id;
+  const auto raw_frame_data = convertToRawData(with_unknown_field_id.hex_dump);
+  const auto num_bytes = 2 * with_unknown_field_id.hex_dump.size();
+
+  monitoring_frame::Message msg;
+  EXPECT_EQ(monitoring_frame::DecodingStatus::unknown_field_id,
+            monitoring_frame::tryDeserialize(raw_frame_data, num_bytes, monitoring_frame::DecodeOptions(), msg));
+}
+
+TEST_F(MonitoringFrameDeserializationTest, tryDeserializeShouldReturnStatusOnTooLargeFieldLength)
+{
+  scanner_udp_datagram_hexdumps::WithTooLargeFieldLength with_too_large_field_length;
+  const auto raw_frame_data = convertToRawData(with_too_large_field_length.hex_dump);
+  const auto num_bytes = 2 * with_too_large_field_length.hex_dump.size();
+
+  monitoring_frame::Message msg;
+  EXPECT_EQ(monitoring_frame::DecodingStatus::field_length_too_large,
+            monitoring_frame::tryDeserialize(raw_frame_data, num_bytes, monitoring_frame::DecodeOptions(), msg));
+}
+
+TEST_F(MonitoringFrameDeserializationTest, tryDeserializeShouldReturnStatusOnTruncatedFrame)
+{
+  const auto raw = serialize(monitoring_frame::MessageBuilder()
+                                 .fromTheta(util::TenthOfDegree(25))
+                                 .resolution(util::TenthOfDegree(1))
+                                 .scanCounter(1)
+                                 .measurements(std::vector<double>(100, 1.))
+                                 .build());
+
+  monitoring_frame::Message msg;
+  EXPECT_NE(monitoring_frame::DecodingStatus::ok,
+            monitoring_frame::tryDeserialize(raw, raw.size() - 50, monitoring_frame::DecodeOptions(), msg));
+  EXPECT_EQ(monitoring_frame::DecodingStatus::truncated_frame,
+            monitoring_frame::tryDeserialize(raw, 10, monitoring_frame::DecodeOptions(), msg));
+}
+
+TEST_F(MonitoringFrameDeserializationTest, tryDeserializeShouldReturnStatusOnUnexpectedFieldSize)
+{
+  scanner_udp_datagram_hexdumps::WithTooLargeScanCounterLength with_too_large_scan_counter_length;
+  const auto raw_frame_data = convertToRawData(with_too_large_scan_counter_length.hex_dump);
+  const auto num_bytes = 2 * with_too_large_scan_counter_length.hex_dump.size();
+
+  monitoring_frame::Message msg;
+  EXPECT_EQ(monitoring_frame::DecodingStatus::unexpected_field_size,
+            monitoring_frame::tryDeserialize(raw_frame_data, num_bytes, monitoring_frame::DecodeOptions(), msg));
+}
+
 TEST_F(MonitoringFrameDeserializationTest, shouldThrowUnexpectedSizeErrorOnTooLargeScanCounterLength)
 {
   scanner_udp_datagram_hexdumps::WithTooLargeScanCounterLength with_too_large_scan_counter_length;
@@ -13,6 +13,8 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+#include <array>
+#include <cstring>
 #include <gtest/gtest.h>
 #include <gtest/gtest-typed-test.h>
 #include <sstream>
@@ -127,6 +129,77 @@ TYPED_TEST(RawProcessingTest, readArrayTooMuch)
                std::exception);
 }
 
+TYPED_TEST(RawProcessingTest, readWithRawDataReader)
+{
+  TypeParam data{ 123 };
+  std::array<char, sizeof(TypeParam)> raw;
+  std::memcpy(raw.data(), &data, sizeof(TypeParam));
+  data_conversion_layer::raw_processing::RawDataReader reader(raw.data(), raw.size());
+
+  const auto data_read = data_conversion_layer::raw_processing::read<TypeParam>(reader);
+
+  EXPECT_EQ(data_read, data);
+  EXPECT_EQ(reader.position(), sizeof(TypeParam));
+  EXPECT_EQ(reader.remaining(), 0u);
+}
+
+TYPED_TEST(RawProcessingTest, readTooMuchWithRawDataReader)
+{
+  TypeParam data{ 123 };
+  std::array<char, sizeof(TypeParam)> raw;
+  std::memcpy(raw.data(), &data, sizeof(TypeParam));
+  data_conversion_layer::raw_processing::RawDataReader reader(raw.data(), raw.size());
+
+  TypeParam data_read;
+  data_conversion_layer::raw_processing::read(reader, data_read);
+  EXPECT_THROW(data_conversion_layer::raw_processing::read(reader, data_read),
+               data_conversion_layer::raw_processing::RawDataReadFailure);
+}
+
+TYPED_TEST(RawProcessingTest, readArrayWithRawDataReader)
+{
+  const std::vector<TypeParam> data{ (TypeParam)123, (TypeParam)345 };
+  std::vector<char> raw(data.size() * sizeof(TypeParam));
+  std::memcpy(raw.data(), data.data(), raw.size());
+  data_conversion_layer::raw_processing::RawDataReader reader(raw.data(), raw.size());
+
+  std::vector<TypeParam> data_read;
+  data_conversion_layer::raw_processing::readArray<TypeParam, TypeParam>(
+      reader, data_read, data.size(), [](TypeParam raw_data) { return raw_data * 2; });
+
+  ASSERT_EQ(data_read.size(), data.size());
+  for (size_t i = 0; i < data_read.size(); ++i)
+  {
+    EXPECT_EQ(data_read.at(i), data.at(i) * 2);
+  }
+}
+
+TYPED_TEST(RawProcessingTest, readArrayTooMuchWithRawDataReader)
+{
+  const std::vector<TypeParam> data{ (TypeParam)123, (TypeParam)345 };
+  std::vector<char> raw(data.size() * sizeof(TypeParam));
+  std::memcpy(raw.data(), data.data(), raw.size());
+  data_conversion_layer::raw_processing::RawDataReader reader(raw.data(), raw.size());
+
+  std::vector<TypeParam> data_read;
+  EXPECT_THROW((data_conversion_layer::raw_processing::readArray<TypeParam, TypeParam>(
+                   reader, data_read, data.size() + 1, [](TypeParam raw_data) { return raw_data; })),
+               data_conversion_layer::raw_processing::RawDataReadFailure);
+  EXPECT_EQ(reader.position(), 0u);
+}
+
+TEST(RawDataReaderTest, shouldSkipBytes)
+{
+  const std::array<char, 3> raw{ 0x01, 0x02, 0x03 };
+  data_conversion_layer::raw_processing::RawDataReader reader(raw.data(), raw.size());
+
+  reader.skip(2);
+
+  EXPECT_EQ(reader.current(), raw.data() + 2);
+  EXPECT_EQ(data_conversion_layer::raw_processing::read<uint8_t>(reader), 0x03);
+  EXPECT_THROW(reader.skip(1), data_conversion_layer::raw_processing::RawDataReadFailure);
+}
+
 }  // namespace psen_scan_v2_standalone_test
 
 int main(int argc, char** argv)
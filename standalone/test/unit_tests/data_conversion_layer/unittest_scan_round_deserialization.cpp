@@ -0,0 +1,226 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/laserscan_conversions.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_decode_options.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg_builder.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/scan_round_deserialization.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data_helper.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_serialization.h"
+
+using namespace psen_scan_v2_standalone;
+using namespace data_conversion_layer;
+
+namespace psen_scan_v2_standalone_test
+{
+using monitoring_frame::DecodeField;
+using monitoring_frame::DecodeOptions;
+using monitoring_frame::MessageBuilder;
+using monitoring_frame::MessageStamped;
+using monitoring_frame::RawFrameStamped;
+
+static const int64_t DEFAULT_TIMESTAMP{ 4500000 };
+
+static MessageBuilder createDefaultMsgBuilder(const uint32_t msg_nr = 0)
+{
+  return MessageBuilder()
+      .fromTheta(util::TenthOfDegree{ 10 })
+      .resolution(util::TenthOfDegree{ 2 })
+      .scanCounter(42)
+      .activeZoneset(static_cast<uint8_t>(msg_nr))
+      .iOPinData(createPinData({ msg_nr % 8, 0, 0, 0, 0, 0, 0, 0 }, { 7 - (msg_nr % 8), 0, 0, 0 }))
+      .measurements({ 1., 2., 3., 4.5, 5., 42., .4 })
+      .intensities({ 0., 4., 3., 1007., 508., 14000., 16383. });
+}
+
+static RawFrameStamped toRawFrame(const monitoring_frame::Message& msg, const int64_t timestamp)
+{
+  const auto data{ std::make_shared<RawData>(monitoring_frame::serialize(msg)) };
+  return RawFrameStamped(data, data->size(), timestamp);
+}
+
+//! @brief Creates the frames of a valid scan round, which are received in reverse order of their angles.
+static std::vector<RawFrameStamped> createScanRound(const std::size_t num_frames)
+{
+  std::vector<RawFrameStamped> frames;
+  for (std::size_t i = 0; i < num_frames; ++i)
+  {
+    const auto from_theta{ util::TenthOfDegree{ 10 } + util::TenthOfDegree{ 2 } * static_cast<int>(7 * i) };
+    frames.push_back(toRawFrame(createDefaultMsgBuilder(i).fromTheta(from_theta),
+                                DEFAULT_TIMESTAMP * static_cast<int64_t>(num_frames - i)));
+  }
+  return frames;
+}
+
+static LaserScan toLaserScanPerFrame(const std::vector<RawFrameStamped>& frames,
+                                     const DecodeOptions& options = DecodeOptions())
+{
+  std::vector<MessageStamped> stamped_msgs;
+  for (const auto& frame : frames)
+  {
+    stamped_msgs.emplace_back(monitoring_frame::deserialize(*frame.data_, frame.num_bytes_, options), frame.stamp_);
+  }
+  return LaserScanConverter::toLaserScan(stamped_msgs);
+}
+
+static void expectScansEqual(const LaserScan& expected, const LaserScan& actual)
+{
+  EXPECT_EQ(expected.scanResolution(), actual.scanResolution());
+  EXPECT_EQ(expected.minScanAngle(), actual.minScanAngle());
+  EXPECT_EQ(expected.maxScanAngle(), actual.maxScanAngle());
+  EXPECT_EQ(expected.scanCounter(), actual.scanCounter());
+  EXPECT_EQ(expected.activeZoneset(), actual.activeZoneset());
+  EXPECT_EQ(expected.timestamp(), actual.timestamp());
+  EXPECT_EQ(expected.scannerId(), actual.scannerId());
+  EXPECT_EQ(expected.measurements(), actual.measurements());
+  EXPECT_EQ(expected.intensities(), actual.intensities());
+  EXPECT_EQ(expected.singlePrecisionMeasurements(), actual.singlePrecisionMeasurements());
+  EXPECT_EQ(expected.singlePrecisionIntensities(), actual.singlePrecisionIntensities());
+  EXPECT_EQ(expected.rawMeasurements(), actual.rawMeasurements());
+  EXPECT_EQ(expected.rawIntensities(), actual.rawIntensities());
+  EXPECT_EQ(expected.ioStates(), actual.ioStates());
+}
+
+TEST(ScanRoundDeserializationTest, shouldCreateSameLaserScanAsPerFrameDeserialization)
+{
+  const auto frames{ createScanRound(6) };
+  expectScansEqual(toLaserScanPerFrame(frames), deserializeScanRound(frames));
+}
+
+TEST(ScanRoundDeserializationTest, shouldCreateSameLaserScanAsPerFrameDeserializationInSinglePrecision)
+{
+  const auto frames{ createScanRound(6) };
+  const auto options{ DecodeOptions().withSinglePrecision() };
+  const LaserScan scan{ deserializeScanRound(frames, options) };
+  EXPECT_TRUE(scan.isSinglePrecision());
+  expectScansEqual(toLaserScanPerFrame(frames, options), scan);
+}
+
+TEST(ScanRoundDeserializationTest, shouldCreateSameLaserScanAsPerFrameDeserializationWithRawSamples)
+{
+  const auto frames{ createScanRound(6) };
+  const auto options{ DecodeOptions().withRawSamples() };
+  const LaserScan scan{ deserializeScanRound(frames, options) };
+  EXPECT_TRUE(scan.hasRawSamples());
+  expectScansEqual(toLaserScanPerFrame(frames, options), scan);
+}
+
+TEST(ScanRoundDeserializationTest, shouldSkipDeselectedIntensitiesAndIOStates)
+{
+  const auto options{ DecodeOptions().without(DecodeField::intensities).without(DecodeField::io_pin_data) };
+  const LaserScan scan{ deserializeScanRound(createScanRound(3), options) };
+  EXPECT_EQ(21u, scan.measurements().size());
+  EXPECT_TRUE(scan.intensities().empty());
+  EXPECT_TRUE(scan.ioStates().empty());
+}
+
+TEST(ScanRoundDeserializationTest, shouldSkipIntensitiesIfOneFrameHasNone)
+{
+  auto frames{ createScanRound(3) };
+  frames.back() = toRawFrame(createDefaultMsgBuilder().fromTheta(util::TenthOfDegree{ 38 }).intensities({}), 1);
+  const LaserScan scan{ deserializeScanRound(frames) };
+  EXPECT_EQ(21u, scan.measurements().size());
+  EXPECT_TRUE(scan.intensities().empty());
+}
+
+TEST(ScanRoundDeserializationTest, shouldIgnoreEmptyFrames)
+{
+  // The following from_theta's are a real example from wireshark.
+  const std::vector<RawFrameStamped> frames = {
+    toRawFrame(createDefaultMsgBuilder().fromTheta(util::TenthOfDegree(2500)).measurements({}).intensities({}), 3),
+    toRawFrame(createDefaultMsgBuilder().fromTheta(util::TenthOfDegree(0)).measurements({}).intensities({}), 4),
+    toRawFrame(createDefaultMsgBuilder().fromTheta(util::TenthOfDegree(1318)).intensities({}), 40000),
+    toRawFrame(createDefaultMsgBuilder().fromTheta(util::TenthOfDegree(2000)).measurements({}).intensities({}), 8)
+  };
+  expectScansEqual(toLaserScanPerFrame(frames), deserializeScanRound(frames));
+}
+
+TEST(ScanRoundDeserializationTest, shouldReturnStatusOnMissingFrames)
+{
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(ScanConversionStatus::no_frames, tryDeserializeScanRound({}, DecodeOptions(), scan));
+  EXPECT_FALSE(scan.is_initialized());
+}
+
+TEST(ScanRoundDeserializationTest, shouldReturnStatusOnMismatchingResolutions)
+{
+  auto frames{ createScanRound(3) };
+  frames.back() = toRawFrame(
+      createDefaultMsgBuilder().fromTheta(util::TenthOfDegree{ 38 }).resolution(util::TenthOfDegree{ 1 }), 1);
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(ScanConversionStatus::resolutions_mismatch, tryDeserializeScanRound(frames, DecodeOptions(), scan));
+  EXPECT_FALSE(scan.is_initialized());
+}
+
+TEST(ScanRoundDeserializationTest, shouldReturnStatusOnZeroResolution)
+{
+  const std::vector<RawFrameStamped> frames{
+    toRawFrame(createDefaultMsgBuilder().fromTheta(util::TenthOfDegree{ 10 }).resolution(util::TenthOfDegree{ 0 }), 1),
+    toRawFrame(createDefaultMsgBuilder().fromTheta(util::TenthOfDegree{ 24 }).resolution(util::TenthOfDegree{ 0 }), 2)
+  };
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(ScanConversionStatus::invalid_resolution, tryDeserializeScanRound(frames, DecodeOptions(), scan));
+  EXPECT_FALSE(scan.is_initialized());
+}
+
+TEST(ScanRoundDeserializationTest, shouldReturnStatusOnMismatchingScanCounters)
+{
+  auto frames{ createScanRound(3) };
+  frames.back() = toRawFrame(createDefaultMsgBuilder().fromTheta(util::TenthOfDegree{ 38 }).scanCounter(43), 1);
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(ScanConversionStatus::scan_counters_mismatch, tryDeserializeScanRound(frames, DecodeOptions(), scan));
+  EXPECT_FALSE(scan.is_initialized());
+}
+
+TEST(ScanRoundDeserializationTest, shouldReturnStatusOnMismatchingThetaAngles)
+{
+  auto frames{ createScanRound(3) };
+  frames.back() = toRawFrame(createDefaultMsgBuilder().fromTheta(util::TenthOfDegree{ 40 }), 1);
+  boost::optional<LaserScan> scan;
+  EXPECT_EQ(ScanConversionStatus::theta_angles_mismatch, tryDeserializeScanRound(frames, DecodeOptions(), scan));
+  EXPECT_FALSE(scan.is_initialized());
+}
+
+TEST(ScanRoundDeserializationTest, shouldThrowProtocolErrorOnInvalidScanRound)
+{
+  EXPECT_THROW(deserializeScanRound({}), ScannerProtocolViolationError);
+}
+
+TEST(ScanRoundDeserializationTest, shouldThrowDecodingFailureOnMalformedFrame)
+{
+  auto frames{ createScanRound(2) };
+  frames.back().num_bytes_ -= 6;
+  EXPECT_THROW(deserializeScanRound(frames), monitoring_frame::DecodingFailure);
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
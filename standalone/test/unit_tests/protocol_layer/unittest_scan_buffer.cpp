@@ -0,0 +1,318 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/configuration/default_parameters.h"
+#include "psen_scan_v2_standalone/configuration/scanner_ids.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg_builder.h"
+#include "psen_scan_v2_standalone/protocol_layer/scan_buffer.h"
+
+using namespace psen_scan_v2_standalone;
+
+// Counts the heap allocations of the test, to check the steady state of the ScanBuffer.
+static std::size_t num_allocations{ 0 };
+
+void* operator new(std::size_t size)
+{
+  ++num_allocations;
+  if (void* ptr = std::malloc(size))
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+// The replaced operator delete frees the memory of the replaced operator new, which GCC cannot see.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+  std::free(ptr);
+}
+
+namespace psen_scan_v2_standalone_test
+{
+using data_conversion_layer::monitoring_frame::MessageBuilder;
+using data_conversion_layer::monitoring_frame::MessageStamped;
+using protocol_layer::ScanBuffer;
+using protocol_layer::ScanBufferStatus;
+
+static constexpr uint32_t NUM_EXPECTED_MSGS{ 2 };
+
+static MessageStamped createStampedMsg(const uint32_t scan_counter,
+                                       const configuration::ScannerId& scanner_id = configuration::ScannerId::master)
+{
+  return MessageStamped(MessageBuilder().scannerId(scanner_id).scanCounter(scan_counter), 0);
+}
+
+static MessageStamped createStampedMsgAt(const uint32_t scan_counter, const int64_t stamp)
+{
+  return MessageStamped(MessageBuilder().scanCounter(scan_counter), stamp);
+}
+
+static MessageStamped createStampedMsgWithMeasurements(const uint32_t scan_counter, const int16_t from_theta)
+{
+  return MessageStamped(MessageBuilder()
+                            .scanCounter(scan_counter)
+                            .fromTheta(util::TenthOfDegree(from_theta))
+                            .measurements(std::vector<double>(100, 1.0)),
+                        0);
+}
+
+TEST(ScanBufferTest, shouldReturnAddedForFramesOfTheCurrentRound)
+{
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS);
+  EXPECT_EQ(ScanBufferStatus::added, scan_buffer.tryAdd(createStampedMsg(1)));
+  EXPECT_EQ(ScanBufferStatus::added, scan_buffer.tryAdd(createStampedMsg(1)));
+  EXPECT_TRUE(scan_buffer.isRoundComplete());
+}
+
+TEST(ScanBufferTest, shouldReturnOutdatedAndDropFramesOfAnEarlierRound)
+{
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS);
+  scan_buffer.tryAdd(createStampedMsg(2));
+  EXPECT_EQ(ScanBufferStatus::outdated, scan_buffer.tryAdd(createStampedMsg(1)));
+  EXPECT_EQ(1u, scan_buffer.currentRound().size());
+}
+
+TEST(ScanBufferTest, shouldReturnRoundEndedEarlyAndStartNewRoundIfLastRoundWasIncomplete)
+{
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS);
+  scan_buffer.tryAdd(createStampedMsg(1));
+  scan_buffer.tryAdd(createStampedMsg(1));
+  scan_buffer.tryAdd(createStampedMsg(2));
+  EXPECT_EQ(ScanBufferStatus::round_ended_early, scan_buffer.tryAdd(createStampedMsg(3)));
+  ASSERT_EQ(1u, scan_buffer.currentRound().size());
+  EXPECT_EQ(3u, scan_buffer.currentRound()[0].msg_.scanCounter());
+}
+
+TEST(ScanBufferTest, shouldNotReportFirstIncompleteRound)
+{
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS);
+  scan_buffer.tryAdd(createStampedMsg(1));
+  EXPECT_EQ(ScanBufferStatus::added, scan_buffer.tryAdd(createStampedMsg(2)));
+}
+
+TEST(ScanBufferTest, shouldReturnOversaturatedOnTooManyFrames)
+{
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS);
+  scan_buffer.tryAdd(createStampedMsg(1));
+  scan_buffer.tryAdd(createStampedMsg(1));
+  EXPECT_EQ(ScanBufferStatus::oversaturated, scan_buffer.tryAdd(createStampedMsg(1)));
+}
+
+TEST(ScanBufferTest, shouldIgnoreFirstFrameOfSubscriber0)
+{
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS);
+  EXPECT_EQ(ScanBufferStatus::ignored, scan_buffer.tryAdd(createStampedMsg(1, configuration::ScannerId::subscriber0)));
+  EXPECT_TRUE(scan_buffer.currentRound().empty());
+}
+
+TEST(ScanBufferTest, addShouldThrowCorrespondingToTheStatus)
+{
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS);
+  scan_buffer.add(createStampedMsg(1));
+  scan_buffer.add(createStampedMsg(1));
+  EXPECT_THROW(scan_buffer.add(createStampedMsg(1)), protocol_layer::ScanRoundOversaturatedError);
+  EXPECT_THROW(scan_buffer.add(createStampedMsg(0)), protocol_layer::OutdatedMessageError);
+  scan_buffer.add(createStampedMsg(2));
+  EXPECT_THROW(scan_buffer.add(createStampedMsg(3)), protocol_layer::ScanRoundEndedEarlyError);
+}
+
+TEST(ScanBufferTest, shouldThrowOnReorderWindowExceedingMaximum)
+{
+  EXPECT_THROW(ScanBuffer(NUM_EXPECTED_MSGS, configuration::MAX_SCAN_ROUND_REORDER_WINDOW + 1), std::invalid_argument);
+}
+
+TEST(ScanBufferTest, shouldCompleteRoundWithinReorderWindowWhenItsMissingFrameArrives)
+{
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS, 1);
+  scan_buffer.tryAdd(createStampedMsg(1));
+  EXPECT_EQ(ScanBufferStatus::added, scan_buffer.tryAdd(createStampedMsg(2)));
+  EXPECT_FALSE(scan_buffer.isRoundComplete());
+
+  EXPECT_EQ(ScanBufferStatus::added, scan_buffer.tryAdd(createStampedMsg(1)));
+  ASSERT_TRUE(scan_buffer.isRoundComplete());
+  const auto& round{ scan_buffer.takeRound() };
+  ASSERT_EQ(NUM_EXPECTED_MSGS, round.size());
+  EXPECT_EQ(1u, round[0].msg_.scanCounter());
+  EXPECT_EQ(1u, round[1].msg_.scanCounter());
+  ASSERT_EQ(1u, scan_buffer.currentRound().size());
+  EXPECT_EQ(2u, scan_buffer.currentRound()[0].msg_.scanCounter());
+}
+
+TEST(ScanBufferTest, shouldOpenRoundWithinReorderWindowWhoseFirstFrameArrivesLate)
+{
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS, 1);
+  scan_buffer.tryAdd(createStampedMsg(3));
+  EXPECT_EQ(ScanBufferStatus::outdated, scan_buffer.tryAdd(createStampedMsg(1)));
+  EXPECT_EQ(ScanBufferStatus::added, scan_buffer.tryAdd(createStampedMsg(2)));
+  EXPECT_EQ(ScanBufferStatus::added, scan_buffer.tryAdd(createStampedMsg(2)));
+  EXPECT_TRUE(scan_buffer.isRoundComplete());
+}
+
+TEST(ScanBufferTest, shouldReturnRoundEndedEarlyWhenIncompleteRoundFallsOutOfReorderWindow)
+{
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS, 1);
+  scan_buffer.tryAdd(createStampedMsg(1));
+  scan_buffer.tryAdd(createStampedMsg(1));
+  scan_buffer.tryAdd(createStampedMsg(2));
+  EXPECT_EQ(ScanBufferStatus::added, scan_buffer.tryAdd(createStampedMsg(3)));
+  EXPECT_EQ(ScanBufferStatus::round_ended_early, scan_buffer.tryAdd(createStampedMsg(4)));
+  EXPECT_EQ(ScanBufferStatus::outdated, scan_buffer.tryAdd(createStampedMsg(2)));
+}
+
+TEST(ScanBufferTest, shouldOrderFramesOfARoundByTheirAngularPosition)
+{
+  ScanBuffer scan_buffer(3);
+  scan_buffer.tryAdd(createStampedMsgWithMeasurements(1, 200));
+  scan_buffer.tryAdd(createStampedMsgWithMeasurements(1, 0));
+  scan_buffer.tryAdd(createStampedMsgWithMeasurements(1, 100));
+
+  ASSERT_EQ(3u, scan_buffer.currentRound().size());
+  EXPECT_EQ(util::TenthOfDegree(0), scan_buffer.currentRound()[0].msg_.fromTheta());
+  EXPECT_EQ(util::TenthOfDegree(100), scan_buffer.currentRound()[1].msg_.fromTheta());
+  EXPECT_EQ(util::TenthOfDegree(200), scan_buffer.currentRound()[2].msg_.fromTheta());
+}
+
+TEST(ScanBufferTest, shouldHandOffCompleteRoundAndKeepTrackOfIt)
+{
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS);
+  scan_buffer.tryAdd(createStampedMsg(1));
+  scan_buffer.tryAdd(createStampedMsg(1));
+  ASSERT_TRUE(scan_buffer.isRoundComplete());
+
+  EXPECT_EQ(NUM_EXPECTED_MSGS, scan_buffer.takeRound().size());
+  EXPECT_TRUE(scan_buffer.currentRound().empty());
+  EXPECT_EQ(ScanBufferStatus::oversaturated, scan_buffer.tryAdd(createStampedMsg(1)));
+  EXPECT_EQ(ScanBufferStatus::outdated, scan_buffer.tryAdd(createStampedMsg(0)));
+  EXPECT_EQ(ScanBufferStatus::added, scan_buffer.tryAdd(createStampedMsg(2)));
+}
+
+TEST(ScanBufferTest, shouldNotStoreFramesExceedingTheExpectedNumber)
+{
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS);
+  scan_buffer.tryAdd(createStampedMsg(1));
+  scan_buffer.tryAdd(createStampedMsg(1));
+  scan_buffer.tryAdd(createStampedMsg(1));
+  EXPECT_EQ(NUM_EXPECTED_MSGS, scan_buffer.currentRound().size());
+  EXPECT_FALSE(scan_buffer.isRoundComplete());
+}
+
+TEST(ScanBufferTest, shouldHandOffIncompleteRoundOnceItsDeadlinePassed)
+{
+  static constexpr int64_t DEADLINE{ 30 };
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS, 1);
+  scan_buffer.tryAdd(createStampedMsgAt(1, 0));
+  scan_buffer.tryAdd(createStampedMsgAt(1, 0));
+  scan_buffer.tryAdd(createStampedMsgAt(2, 100));
+
+  EXPECT_EQ(nullptr, scan_buffer.takeOverdueRound(createStampedMsgAt(3, 100 + DEADLINE - 1), DEADLINE));
+  const auto* round{ scan_buffer.takeOverdueRound(createStampedMsgAt(3, 100 + DEADLINE), DEADLINE) };
+  ASSERT_NE(nullptr, round);
+  ASSERT_EQ(1u, round->size());
+  EXPECT_EQ(2u, round->at(0).msg_.scanCounter());
+  EXPECT_EQ(nullptr, scan_buffer.takeOverdueRound(createStampedMsgAt(3, 100 + DEADLINE), DEADLINE));
+
+  EXPECT_EQ(ScanBufferStatus::added, scan_buffer.tryAdd(createStampedMsgAt(3, 100 + DEADLINE)));
+  EXPECT_EQ(ScanBufferStatus::outdated, scan_buffer.tryAdd(createStampedMsgAt(2, 100 + DEADLINE)));
+  EXPECT_EQ(ScanBufferStatus::added, scan_buffer.tryAdd(createStampedMsgAt(4, 100 + DEADLINE)));
+}
+
+TEST(ScanBufferTest, shouldCompleteRoundByItsOwnFrameArrivingAfterTheDeadline)
+{
+  static constexpr int64_t DEADLINE{ 30 };
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS);
+  scan_buffer.tryAdd(createStampedMsgAt(1, 0));
+  scan_buffer.tryAdd(createStampedMsgAt(1, 0));
+  scan_buffer.tryAdd(createStampedMsgAt(2, DEADLINE));
+
+  const auto late_msg{ createStampedMsgAt(2, 2 * DEADLINE) };
+  EXPECT_EQ(nullptr, scan_buffer.takeOverdueRound(late_msg, DEADLINE));
+  EXPECT_EQ(ScanBufferStatus::added, scan_buffer.tryAdd(late_msg));
+  EXPECT_TRUE(scan_buffer.isRoundComplete());
+  EXPECT_EQ(NUM_EXPECTED_MSGS, scan_buffer.takeRound().size());
+}
+
+TEST(ScanBufferTest, shouldHandOffIncompleteRoundBeforeItFallsOutOfReorderWindow)
+{
+  static constexpr int64_t DEADLINE{ 30 };
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS);
+  scan_buffer.tryAdd(createStampedMsgAt(1, 0));
+  scan_buffer.tryAdd(createStampedMsgAt(1, 0));
+  scan_buffer.tryAdd(createStampedMsgAt(2, 0));
+
+  EXPECT_EQ(nullptr, scan_buffer.takeOverdueRound(createStampedMsgAt(2, 0), DEADLINE));
+  const auto* round{ scan_buffer.takeOverdueRound(createStampedMsgAt(3, 0), DEADLINE) };
+  ASSERT_NE(nullptr, round);
+  EXPECT_EQ(1u, round->size());
+  EXPECT_EQ(ScanBufferStatus::added, scan_buffer.tryAdd(createStampedMsgAt(3, 0)));
+}
+
+TEST(ScanBufferTest, shouldNotHandOffFirstRound)
+{
+  ScanBuffer scan_buffer(NUM_EXPECTED_MSGS);
+  scan_buffer.tryAdd(createStampedMsgAt(1, 0));
+  EXPECT_EQ(nullptr, scan_buffer.takeOverdueRound(createStampedMsgAt(2, 1000), 30));
+}
+
+TEST(ScanBufferTest, shouldNotAllocateMemoryWhenAddingAndHandingOffRounds)
+{
+  static constexpr uint32_t NUM_ROUNDS{ 10 };
+  static constexpr uint32_t NUM_MSGS_PER_ROUND{ 6 };
+  std::vector<MessageStamped> stamped_msgs;
+  for (uint32_t round = 0; round < NUM_ROUNDS; ++round)
+  {
+    for (uint32_t i = NUM_MSGS_PER_ROUND; i > 0; --i)
+    {
+      stamped_msgs.push_back(createStampedMsgWithMeasurements(round, i * 100));
+    }
+  }
+  ScanBuffer scan_buffer(NUM_MSGS_PER_ROUND);
+
+  const std::size_t num_allocations_before{ num_allocations };
+  std::size_t num_handed_off_msgs{ 0 };
+  for (auto& stamped_msg : stamped_msgs)
+  {
+    if (scan_buffer.tryAdd(std::move(stamped_msg)) == ScanBufferStatus::added && scan_buffer.isRoundComplete())
+    {
+      num_handed_off_msgs += scan_buffer.takeRound().size();
+    }
+  }
+  EXPECT_EQ(num_allocations_before, num_allocations);
+  EXPECT_EQ(NUM_ROUNDS * NUM_MSGS_PER_ROUND, num_handed_off_msgs);
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,123 @@
+// Copyright (c) 2022 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/util/async_barrier.h"
+#include "psen_scan_v2_standalone/util/thread_scheduling.h"
+
+using namespace psen_scan_v2_standalone;
+using util::SchedulingPolicy;
+using util::ThreadScheduling;
+
+namespace psen_scan_v2_standalone_test
+{
+static constexpr std::chrono::seconds DEFAULT_TIMEOUT{ 5 };
+
+//! @brief Thread which idles until the test is finished.
+class IdleThread
+{
+public:
+  IdleThread() : thread_([this]() { finished_barrier_.waitTillRelease(DEFAULT_TIMEOUT); })
+  {
+  }
+  ~IdleThread()
+  {
+    finished_barrier_.release();
+    thread_.join();
+  }
+
+  std::thread& thread()
+  {
+    return thread_;
+  }
+
+private:
+  util::Barrier finished_barrier_;
+  std::thread thread_;
+};
+
+TEST(ThreadSchedulingTest, shouldNotSetAnySettingByDefault)
+{
+  const ThreadScheduling scheduling;
+  EXPECT_FALSE(scheduling.cpuAffinity());
+  EXPECT_FALSE(scheduling.policy());
+  EXPECT_FALSE(scheduling.priority());
+}
+
+TEST(ThreadSchedulingTest, shouldReturnSetSettings)
+{
+  const ThreadScheduling scheduling{ ThreadScheduling().cpuAffinity({ 1, 3 }).realtime(SchedulingPolicy::fifo, 80) };
+  EXPECT_EQ(std::vector<unsigned int>({ 1, 3 }), scheduling.cpuAffinity().value());
+  EXPECT_EQ(SchedulingPolicy::fifo, scheduling.policy().value());
+  EXPECT_EQ(80, scheduling.priority().value());
+  EXPECT_NE(ThreadScheduling(), scheduling);
+}
+
+TEST(ThreadSchedulingTest, shouldThrowInvalidArgumentOnInvalidSettings)
+{
+  EXPECT_THROW(ThreadScheduling().cpuAffinity({}), std::invalid_argument);
+  EXPECT_THROW(ThreadScheduling().cpuAffinity({ 0, 1024 }), std::invalid_argument);
+  EXPECT_THROW(ThreadScheduling().realtime(SchedulingPolicy::fifo, 0), std::invalid_argument);
+  EXPECT_THROW(ThreadScheduling().realtime(SchedulingPolicy::round_robin, 100), std::invalid_argument);
+}
+
+TEST(ThreadSchedulingTest, shouldPinThreadToCpu)
+{
+  IdleThread idle_thread;
+  ASSERT_TRUE(util::applyThreadScheduling(idle_thread.thread(), ThreadScheduling().cpuAffinity({ 0 }), "Test"));
+
+  cpu_set_t cpu_set;
+  ASSERT_EQ(0, ::pthread_getaffinity_np(idle_thread.thread().native_handle(), sizeof(cpu_set), &cpu_set));
+  EXPECT_EQ(1, CPU_COUNT(&cpu_set));
+  EXPECT_TRUE(CPU_ISSET(0, &cpu_set));
+}
+
+TEST(ThreadSchedulingTest, shouldApplyRealtimeSchedulingOrKeepDefaultScheduling)
+{
+  IdleThread idle_thread;
+  // Depends on the privileges the test is run with.
+  const bool applied{ util::applyThreadScheduling(
+      idle_thread.thread(), ThreadScheduling().realtime(SchedulingPolicy::round_robin, 10), "Test") };
+
+  int policy{ -1 };
+  sched_param param{};
+  ASSERT_EQ(0, ::pthread_getschedparam(idle_thread.thread().native_handle(), &policy, &param));
+  if (applied)
+  {
+    EXPECT_EQ(SCHED_RR, policy);
+    EXPECT_EQ(10, param.sched_priority);
+  }
+  else
+  {
+    EXPECT_EQ(SCHED_OTHER, policy);
+  }
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -13,7 +13,10 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+#include <cmath>
+#include <limits>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -132,6 +135,51 @@ TEST(LaserScanROSConversionsTest, laserSensorMsgShouldContainCorrectIntensitiesA
   }
 }
 
+TEST(LaserScanROSConversionsTest, laserSensorMsgShouldContainSinglePrecisionDataAfterConversion)
+{
+  LaserScan laserscan{ createScan() };
+  laserscan.measurements({});
+  laserscan.intensities({});
+  laserscan.singlePrecisionMeasurements({ 1.f, 2.5f, 3.f });
+  laserscan.singlePrecisionIntensities({ 707.f, 304.f, 0.f });
+  const sensor_msgs::LaserScan laserscan_msg = toLaserScanMsg(laserscan, "", 0);
+
+  EXPECT_EQ(laserscan.singlePrecisionMeasurements(), laserscan_msg.ranges);
+  EXPECT_EQ(laserscan.singlePrecisionIntensities(), laserscan_msg.intensities);
+}
+
+TEST(LaserScanROSConversionsTest, laserSensorMsgShouldContainConvertedRawSamplesAfterConversion)
+{
+  LaserScan laserscan{ createScan() };
+  laserscan.measurements({});
+  laserscan.intensities({});
+  laserscan.rawMeasurements({ 1000, 2500, 59956 });
+  laserscan.rawIntensities({ 707, 0b1100000000000001, 0 });
+  const sensor_msgs::LaserScan laserscan_msg = toLaserScanMsg(laserscan, "", 0);
+
+  EXPECT_EQ(std::vector<float>({ 1.f, 2.5f, std::numeric_limits<float>::infinity() }), laserscan_msg.ranges);
+  EXPECT_EQ(std::vector<float>({ 707.f, 1.f, 0.f }), laserscan_msg.intensities);
+}
+
+TEST(LaserScanROSConversionsTest, laserSensorMsgShouldContainNaNForRawSamplesMissingInPartialScan)
+{
+  LaserScan laserscan{ createScan() };
+  laserscan.measurements({});
+  laserscan.intensities({});
+  laserscan.rawMeasurements({ 1000, LaserScan::MISSING_RAW_MEASUREMENT, 59956 });
+  laserscan.rawIntensities({ 707, 0, 0 });
+  laserscan.numberOfMissingMeasurements(1);
+  const sensor_msgs::LaserScan laserscan_msg = toLaserScanMsg(laserscan, "", 0);
+
+  ASSERT_EQ(3u, laserscan_msg.ranges.size());
+  EXPECT_FLOAT_EQ(1.f, laserscan_msg.ranges[0]);
+  EXPECT_TRUE(std::isnan(laserscan_msg.ranges[1]));
+  EXPECT_EQ(std::numeric_limits<float>::infinity(), laserscan_msg.ranges[2]);
+  ASSERT_EQ(3u, laserscan_msg.intensities.size());
+  EXPECT_TRUE(std::isnan(laserscan_msg.intensities[1]));
+  EXPECT_FLOAT_EQ(0.f, laserscan_msg.intensities[2]);
+}
+
 TEST(LaserScanROSConversionsTest, shouldThrowIfLaserScanHasNegativeTimestamp)
 {
   const LaserScan laserscan{ createScan(-1) };